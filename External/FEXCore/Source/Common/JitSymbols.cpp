@@ -1,35 +1,255 @@
 #include "Common/JitSymbols.h"
 
-#include <string>
-#include <sstream>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <cstdio>
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 
+namespace {
+  // Linux perf's jitdump format, see tools/perf/Documentation/jitdump-specification.txt
+  constexpr uint32_t JITDUMP_MAGIC = 0x4A695444;
+  constexpr uint32_t JITDUMP_VERSION = 1;
+  constexpr uint32_t JIT_CODE_LOAD = 0;
+  constexpr uint32_t JIT_CODE_DEBUG_INFO = 2;
+
+  struct JitDumpHeader {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t TotalSize;
+    uint32_t ElfMach;
+    uint32_t Pad1;
+    uint32_t PID;
+    uint64_t Timestamp;
+    uint64_t Flags;
+  };
+
+  struct JitDumpRecordHeader {
+    uint32_t ID;
+    uint32_t TotalSize;
+    uint64_t Timestamp;
+  };
+
+  // Followed by the nul terminated name and the code bytes
+  struct JitDumpCodeLoad {
+    JitDumpRecordHeader Header;
+    uint32_t PID;
+    uint32_t TID;
+    uint64_t VMA;
+    uint64_t CodeAddr;
+    uint64_t CodeSize;
+    uint64_t CodeIndex;
+  };
+
+  // Followed by NumEntries JitDumpDebugEntry
+  struct JitDumpDebugInfo {
+    JitDumpRecordHeader Header;
+    uint64_t CodeAddr;
+    uint64_t NumEntries;
+  };
+
+  // Followed by the nul terminated file name
+  struct JitDumpDebugEntry {
+    uint64_t CodeAddr;
+    uint32_t Line;
+    uint32_t Discriminator;
+  };
+
+  static_assert(sizeof(JitDumpHeader) == 40, "Header layout is fixed by perf");
+  static_assert(sizeof(JitDumpCodeLoad) == 56, "Record layout is fixed by perf");
+  static_assert(sizeof(JitDumpDebugInfo) == 32, "Record layout is fixed by perf");
+  static_assert(sizeof(JitDumpDebugEntry) == 16, "Record layout is fixed by perf");
+
+  // perf record -k 1 samples with CLOCK_MONOTONIC
+  uint64_t GetTimestamp() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1'000'000'000ULL + ts.tv_nsec;
+  }
+}
+
 namespace FEXCore {
-  JITSymbols::JITSymbols() {
-    std::stringstream PerfMap;
-    PerfMap << "/tmp/perf-" << getpid() << ".map";
+  JITSymbols::~JITSymbols() {
+    std::lock_guard<std::mutex> lk(BufferMutex);
+    Close();
+  }
 
-    fp = fopen(PerfMap.str().c_str(), "wb");
-    if (fp) {
-      // Disable buffering on this file
-      setvbuf(fp, nullptr, _IONBF, 0);
+  void JITSymbols::SetMode(std::string_view Name) {
+    Mode NewMode = Mode::NONE;
+    if (Name == "perfmap") {
+      NewMode = Mode::PERFMAP;
+    }
+    else if (Name == "jitdump") {
+      NewMode = Mode::JITDUMP;
     }
+
+    std::lock_guard<std::mutex> lk(BufferMutex);
+    if (NewMode == CurrentMode.load()) {
+      return;
+    }
+
+    Close();
+    Open(NewMode);
   }
 
-  JITSymbols::~JITSymbols() {
-    if (fp) {
-      fclose(fp);
+  void JITSymbols::Open(Mode NewMode) {
+    if (NewMode == Mode::NONE) {
+      return;
+    }
+
+    char Path[64];
+    snprintf(Path, sizeof(Path), NewMode == Mode::PERFMAP ? "/tmp/perf-%d.map" : "/tmp/jit-%d.dump", getpid());
+
+    fd = open(Path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd == -1) {
+      LogMan::Msg::E("Couldn't open JIT symbol file '%s'", Path);
+      return;
     }
+
+    if (NewMode == Mode::JITDUMP) {
+      // perf finds the dump through this executable mapping showing up in its mmap records
+      JitDumpMarkerSize = sysconf(_SC_PAGESIZE);
+      JitDumpMarker = mmap(nullptr, JitDumpMarkerSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+      if (JitDumpMarker == MAP_FAILED) {
+        LogMan::Msg::E("Couldn't map jitdump marker for '%s'", Path);
+        JitDumpMarker = nullptr;
+        close(fd);
+        fd = -1;
+        return;
+      }
+
+      JitDumpHeader Header{};
+      Header.Magic = JITDUMP_MAGIC;
+      Header.Version = JITDUMP_VERSION;
+      Header.TotalSize = sizeof(Header);
+#ifdef _M_X86_64
+      Header.ElfMach = EM_X86_64;
+#elif defined(_M_ARM_64)
+      Header.ElfMach = EM_AARCH64;
+#endif
+      Header.PID = getpid();
+      Header.Timestamp = GetTimestamp();
+      Append(Header);
+    }
+
+    CodeIndex = 0;
+    CurrentMode.store(NewMode);
   }
 
-  void JITSymbols::Register(void *HostAddr, uint64_t GuestAddr, uint32_t CodeSize) {
-    if (!fp) return;
+  void JITSymbols::Close() {
+    // Waits out a batch that is still being written to this fd
+    // BufferMutex stays held, so whatever is still batched is the last of this file
+    std::lock_guard<std::mutex> WriteLock(WriteMutex);
+    WriteBatch(Buffer);
+    Buffer.clear();
+
+    if (JitDumpMarker) {
+      munmap(JitDumpMarker, JitDumpMarkerSize);
+      JitDumpMarker = nullptr;
+    }
 
+    if (fd != -1) {
+      close(fd);
+      fd = -1;
+    }
+
+    CurrentMode.store(Mode::NONE);
+  }
+
+  void JITSymbols::Flush() {
+    std::unique_lock<std::mutex> lk(BufferMutex);
+    FlushLocked(lk);
+  }
+
+  void JITSymbols::FlushLocked(std::unique_lock<std::mutex> &lk) {
+    std::vector<uint8_t> Batch;
+    Batch.swap(Buffer);
+
+    // Taking WriteMutex before dropping BufferMutex keeps batches in the order they were filled
+    std::lock_guard<std::mutex> WriteLock(WriteMutex);
+    lk.unlock();
+
+    WriteBatch(Batch);
+  }
+
+  void JITSymbols::WriteBatch(std::vector<uint8_t> const &Batch) {
+    size_t Offset = 0;
+    while (fd != -1 && Offset < Batch.size()) {
+      ssize_t Written = write(fd, Batch.data() + Offset, Batch.size() - Offset);
+      if (Written <= 0) {
+        break;
+      }
+      Offset += Written;
+    }
+  }
+
+  void JITSymbols::Register(void const *HostAddr, uint32_t CodeSize, uint64_t GuestAddr, std::string const &Name) {
+    if (!IsEnabled()) {
+      return;
+    }
+
+    std::unique_lock<std::mutex> lk(BufferMutex);
+    switch (CurrentMode.load()) {
+      case Mode::PERFMAP:
+        WritePerfMap(HostAddr, CodeSize, Name);
+        break;
+      case Mode::JITDUMP:
+        WriteJitDump(HostAddr, CodeSize, GuestAddr, Name);
+        break;
+      default: return;
+    }
+
+    if (Buffer.size() >= BUFFER_FLUSH_SIZE) {
+      FlushLocked(lk);
+    }
+  }
+
+  void JITSymbols::WritePerfMap(void const *HostAddr, uint32_t CodeSize, std::string const &Name) {
     // Linux perf format is very straightforward
     // `<HostPtr> <Size> <Name>\n`
-    std::stringstream String;
-    String << std::hex << HostAddr << " " << CodeSize << " " << "JIT_0x" << GuestAddr << "_" << HostAddr << std::endl;
-    fwrite(String.str().c_str(), 1, String.str().size(), fp);
+    char Prefix[48];
+    int PrefixSize = snprintf(Prefix, sizeof(Prefix), "%lx %x ", reinterpret_cast<uintptr_t>(HostAddr), CodeSize);
+    Append(Prefix, PrefixSize);
+    Append(Name.data(), Name.size());
+    Buffer.emplace_back('\n');
   }
-}
 
+  void JITSymbols::WriteJitDump(void const *HostAddr, uint32_t CodeSize, uint64_t GuestAddr, std::string const &Name) {
+    uint64_t Timestamp = GetTimestamp();
+    uint64_t Host = reinterpret_cast<uintptr_t>(HostAddr);
+    uint32_t NameSize = Name.size() + 1;
+
+    // Debug info needs to come before the load it describes
+    // We only know the guest address at the start of the code, the line is the guest address' low 32bits
+    JitDumpDebugInfo DebugInfo{};
+    DebugInfo.Header.ID = JIT_CODE_DEBUG_INFO;
+    DebugInfo.Header.TotalSize = sizeof(JitDumpDebugInfo) + sizeof(JitDumpDebugEntry) + NameSize;
+    DebugInfo.Header.Timestamp = Timestamp;
+    DebugInfo.CodeAddr = Host;
+    DebugInfo.NumEntries = 1;
+    Append(DebugInfo);
+
+    JitDumpDebugEntry Entry{};
+    Entry.CodeAddr = Host;
+    Entry.Line = static_cast<uint32_t>(GuestAddr);
+    Append(Entry);
+    Append(Name.c_str(), NameSize);
+
+    JitDumpCodeLoad Load{};
+    Load.Header.ID = JIT_CODE_LOAD;
+    Load.Header.TotalSize = sizeof(JitDumpCodeLoad) + NameSize + CodeSize;
+    Load.Header.Timestamp = Timestamp;
+    Load.PID = getpid();
+    Load.TID = gettid();
+    Load.VMA = Host;
+    Load.CodeAddr = Host;
+    Load.CodeSize = CodeSize;
+    Load.CodeIndex = CodeIndex++;
+    Append(Load);
+    Append(Name.c_str(), NameSize);
+    Append(HostAddr, CodeSize);
+  }
+}
@@ -1,14 +1,74 @@
 #pragma once
+#include <atomic>
 #include <cstdint>
-#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace FEXCore {
+/**
+ * @brief Tells host profilers about the code we JIT
+ *
+ * Two outputs are supported, selected at runtime:
+ * - perfmap: `/tmp/perf-<pid>.map`, perf picks this up on its own
+ * - jitdump: `/tmp/jit-<pid>.dump`, needs `perf record -k 1` and `perf inject --jit`
+ *   Includes the host code bytes and a debug line entry pointing back to the guest address
+ *
+ * Records are batched in memory and written out once the buffer fills, a thread exits or the mode changes.
+ * A full batch is written after BufferMutex is dropped, so only the thread that filled it waits on the write.
+ */
 class JITSymbols final {
 public:
-  JITSymbols();
+  enum class Mode {
+    NONE,
+    PERFMAP,
+    JITDUMP,
+  };
+
+  JITSymbols() = default;
   ~JITSymbols();
-  void Register(void *HostAddr, uint64_t GuestAddr, uint32_t CodeSize);
+
+  /**
+   * @brief Switches output mode, accepts `perfmap`, `jitdump` or anything else to disable
+   */
+  void SetMode(std::string_view Name);
+
+  bool IsEnabled() const { return CurrentMode.load(std::memory_order_relaxed) != Mode::NONE; }
+
+  void Register(void const *HostAddr, uint32_t CodeSize, uint64_t GuestAddr, std::string const &Name);
+  void Flush();
+
 private:
-  FILE* fp{};
+  static constexpr size_t BUFFER_FLUSH_SIZE = 1024 * 1024;
+
+  std::atomic<Mode> CurrentMode {Mode::NONE};
+  std::mutex BufferMutex;
+  std::vector<uint8_t> Buffer;
+  // Keeps batches in order and the fd open while a batch is written. Always taken after BufferMutex
+  std::mutex WriteMutex;
+  int fd {-1};
+  void *JitDumpMarker {};
+  size_t JitDumpMarkerSize {};
+  uint64_t CodeIndex {};
+
+  void Open(Mode NewMode);
+  void Close();
+  void FlushLocked(std::unique_lock<std::mutex> &lk);
+  // Needs WriteMutex held
+  void WriteBatch(std::vector<uint8_t> const &Batch);
+
+  void WritePerfMap(void const *HostAddr, uint32_t CodeSize, std::string const &Name);
+  void WriteJitDump(void const *HostAddr, uint32_t CodeSize, uint64_t GuestAddr, std::string const &Name);
+
+  template<typename T>
+  void Append(T const &Data) {
+    auto Bytes = reinterpret_cast<uint8_t const*>(&Data);
+    Buffer.insert(Buffer.end(), Bytes, Bytes + sizeof(T));
+  }
+  void Append(void const *Data, size_t Size) {
+    auto Bytes = reinterpret_cast<uint8_t const*>(Data);
+    Buffer.insert(Buffer.end(), Bytes, Bytes + Size);
+  }
 };
 }
@@ -43,5 +43,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SOFTFLOAT_BUILTIN_CLZ 1
 #define SOFTFLOAT_INTRINSIC_INT128 1
 #define SOFTFLOAT_FAST_INT64 1
+#define THREAD_LOCAL __thread
 #include "opts-GCC.h"
 
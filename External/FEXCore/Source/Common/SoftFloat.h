@@ -12,6 +12,14 @@ extern "C" {
 #include "SoftFloat-3e/softfloat.h"
 }
 
+#ifdef _M_X86_64
+// Takes the host x87 path when it is enabled, otherwise falls through to softfloat
+// Only for use inside of X80SoftFloat, undefined again at the end of this header
+#define X87_HOST_PATH(Expr) if (UseHostX87) { return Expr; }
+#else
+#define X87_HOST_PATH(Expr)
+#endif
+
 struct X80SoftFloat {
 #ifdef _M_X86_64
 #define BIGFLOAT __float128
@@ -26,6 +34,62 @@ struct X80SoftFloat {
     unsigned Sign        : 1;
   };
 
+#ifdef _M_X86_64
+  /**
+   * @brief Runs ops on the host's x87 unit instead of in softfloat
+   *
+   * The host unit gives bit exact results, including for the transcendental ops that softfloat only approximates through BIGFLOAT.
+   * Softfloat stays selectable as a reference for validating against.
+   */
+  static inline bool UseHostX87 {true};
+#endif
+
+  /**
+   * @brief Applies the rounding and precision control of a guest x87 control word
+   *
+   * This is per thread state, only needs to be called when the guest's control word changes
+   *
+   * With the host x87 path this loads the guest's PC and RC in to the host unit, which any long double code
+   * FEX runs on this thread shares. Use RestoreHostControlWord before returning to code that isn't emulating the guest.
+   */
+  static void SetControlWord(uint16_t FCW) {
+    switch ((FCW >> 10) & 0b11) {
+      case 0b00: softfloat_roundingMode = softfloat_round_near_even; break;
+      case 0b01: softfloat_roundingMode = softfloat_round_min; break;
+      case 0b10: softfloat_roundingMode = softfloat_round_max; break;
+      case 0b11: softfloat_roundingMode = softfloat_round_minMag; break;
+    }
+
+    switch ((FCW >> 8) & 0b11) {
+      case 0b00: extF80_roundingPrecision = 32; break;
+      case 0b10: extF80_roundingPrecision = 64; break;
+      // 0b01 is reserved
+      default: extF80_roundingPrecision = 80; break;
+    }
+
+#ifdef _M_X86_64
+    if (UseHostX87) {
+      // We don't emulate x87 exceptions, keep them masked on the host
+      uint16_t HostFCW = FCW | 0x3F;
+      asm volatile("fldcw %0" :: "m" (HostFCW));
+    }
+#endif
+  }
+
+  /**
+   * @brief Puts the host x87 unit back to the control word FEX itself runs with
+   *
+   * FEX never changes its own control word, so that is the Linux default of everything masked, 64bit precision and round to nearest
+   */
+  static void RestoreHostControlWord() {
+#ifdef _M_X86_64
+    if (UseHostX87) {
+      uint16_t HostFCW = 0x37F;
+      asm volatile("fldcw %0" :: "m" (HostFCW));
+    }
+#endif
+  }
+
   X80SoftFloat() { memset(this, 0, sizeof(*this)); }
   X80SoftFloat(unsigned _Sign, uint16_t _Exponent, uint64_t _Significand)
     : Significand {_Significand}
@@ -45,22 +109,27 @@ struct X80SoftFloat {
 
   // Ops
   static X80SoftFloat FADD(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(ToHost(lhs) + ToHost(rhs)));
     return extF80_add(lhs, rhs);
   }
 
   static X80SoftFloat FSUB(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(ToHost(lhs) - ToHost(rhs)));
     return extF80_sub(lhs, rhs);
   }
 
   static X80SoftFloat FMUL(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(ToHost(lhs) * ToHost(rhs)));
     return extF80_mul(lhs, rhs);
   }
 
   static X80SoftFloat FDIV(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(ToHost(lhs) / ToHost(rhs)));
     return extF80_div(lhs, rhs);
   }
 
   static X80SoftFloat FREM(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(HostFPREM(ToHost(lhs), ToHost(rhs))));
     X80SoftFloat Rem = extF80_rem(lhs, rhs);
     if (SignBit(Rem)) {
       Rem = extF80_add(Rem, rhs);
@@ -73,14 +142,17 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FREM1(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(HostFPREM1(ToHost(lhs), ToHost(rhs))));
     return extF80_rem(lhs, rhs);
   }
 
   static X80SoftFloat FRNDINT(X80SoftFloat const &lhs) {
-    return extF80_roundToInt(lhs, softfloat_round_near_even, false);
+    X87_HOST_PATH(FromHost(HostOp<Op_FRNDINT>(ToHost(lhs))));
+    return extF80_roundToInt(lhs, softfloat_roundingMode, false);
   }
 
   static X80SoftFloat FXTRACT_SIG(X80SoftFloat const &lhs) {
+    X87_HOST_PATH(FromHost(HostFXTRACT(ToHost(lhs), false)));
     X80SoftFloat Tmp = lhs;
     Tmp.Exponent = 0x3FFF;
     Tmp.Sign = lhs.Sign;
@@ -88,19 +160,32 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FXTRACT_EXP(X80SoftFloat const &lhs) {
+    X87_HOST_PATH(FromHost(HostFXTRACT(ToHost(lhs), true)));
     int32_t TrueExp = lhs.Exponent - ExponentBias;
     return i32_to_extF80(TrueExp);
   }
 
   static void FCMP(X80SoftFloat const &lhs, X80SoftFloat const &rhs, bool *eq, bool *lt, bool *nan) {
+#ifdef _M_X86_64
+    if (UseHostX87) {
+      long double Src1 = ToHost(lhs);
+      long double Src2 = ToHost(rhs);
+      *eq = Src1 == Src2;
+      *lt = Src1 < Src2;
+      *nan = std::isnan(Src1) || std::isnan(Src2);
+      return;
+    }
+#endif
     *eq = extF80_eq(lhs, rhs);
     *lt = extF80_lt(lhs, rhs);
     *nan = IsNan(lhs) || IsNan(rhs);
   }
 
   static X80SoftFloat FSCALE(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(HostBinaryOp<Op_FSCALE>(ToHost(lhs), ToHost(rhs))));
     WARN_ONCE("x87: Application used FSCALE which may have accuracy problems");
-    X80SoftFloat Int = FRNDINT(rhs);
+    // The scale is truncated towards zero regardless of the guest's rounding control
+    X80SoftFloat Int = extF80_roundToInt(rhs, softfloat_round_minMag, false);
     BIGFLOAT Src2_d = Int;
     Src2_d = exp2l(Src2_d);
     X80SoftFloat Src2_X80 = Src2_d;
@@ -109,6 +194,7 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat F2XM1(X80SoftFloat const &lhs) {
+    X87_HOST_PATH(FromHost(HostOp<Op_F2XM1>(ToHost(lhs))));
     WARN_ONCE("x87: Application used F2XM1 which may have accuracy problems");
     BIGFLOAT Src1_d = lhs;
     BIGFLOAT Result = exp2l(Src1_d);
@@ -117,6 +203,7 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FYL2X(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    X87_HOST_PATH(FromHost(HostBinaryOp<Op_FYL2X>(ToHost(lhs), ToHost(rhs))));
     WARN_ONCE("x87: Application used FYL2X which may have accuracy problems");
     BIGFLOAT Src1_d = lhs;
     BIGFLOAT Src2_d = rhs;
@@ -125,6 +212,8 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FATAN(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    // fpatan is atan(ST1 / ST0)
+    X87_HOST_PATH(FromHost(HostBinaryOp<Op_FPATAN>(ToHost(rhs), ToHost(lhs))));
     WARN_ONCE("x87: Application used FATAN which may have accuracy problems");
     BIGFLOAT Src1_d = lhs;
     BIGFLOAT Src2_d = rhs;
@@ -133,6 +222,7 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FTAN(X80SoftFloat const &lhs) {
+    X87_HOST_PATH(FromHost(HostOp<Op_FPTAN>(ToHost(lhs))));
     WARN_ONCE("x87: Application used FTAN which may have accuracy problems");
     BIGFLOAT Src_d = lhs;
     Src_d = tanl(Src_d);
@@ -140,6 +230,7 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FSIN(X80SoftFloat const &lhs) {
+    X87_HOST_PATH(FromHost(HostOp<Op_FSIN>(ToHost(lhs))));
     WARN_ONCE("x87: Application used FSIN which may have accuracy problems");
     BIGFLOAT Src_d = lhs;
     Src_d = sinl(Src_d);
@@ -147,6 +238,7 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FCOS(X80SoftFloat const &lhs) {
+    X87_HOST_PATH(FromHost(HostOp<Op_FCOS>(ToHost(lhs))));
     WARN_ONCE("x87: Application used FCOS which may have accuracy problems");
     BIGFLOAT Src_d = lhs;
     Src_d = cosl(Src_d);
@@ -154,15 +246,18 @@ struct X80SoftFloat {
   }
 
   static X80SoftFloat FSQRT(X80SoftFloat const &lhs) {
+    X87_HOST_PATH(FromHost(HostOp<Op_FSQRT>(ToHost(lhs))));
     return extF80_sqrt(lhs);
   }
 
   operator float() const {
+    X87_HOST_PATH(static_cast<float>(ToHost(*this)));
     float32_t Result = extF80_to_f32(*this);
     return *(float*)&Result;
   }
 
   operator double() const {
+    X87_HOST_PATH(static_cast<double>(ToHost(*this)));
     float64_t Result = extF80_to_f64(*this);
     return *(double*)&Result;
   }
@@ -173,15 +268,18 @@ struct X80SoftFloat {
   }
 
   operator int16_t() const {
-    return extF80_to_i32(*this, softfloat_round_near_even, false);
+    X87_HOST_PATH(HostFIST<int16_t>(ToHost(*this)));
+    return extF80_to_i32(*this, softfloat_roundingMode, false);
   }
 
   operator int32_t() const {
-    return extF80_to_i32(*this, softfloat_round_near_even, false);
+    X87_HOST_PATH(HostFIST<int32_t>(ToHost(*this)));
+    return extF80_to_i32(*this, softfloat_roundingMode, false);
   }
 
   operator int64_t() const {
-    return extF80_to_i64(*this, softfloat_round_near_even, false);
+    X87_HOST_PATH(HostFIST<int64_t>(ToHost(*this)));
+    return extF80_to_i64(*this, softfloat_roundingMode, false);
   }
 
   operator uint64_t() const {
@@ -262,9 +360,88 @@ struct X80SoftFloat {
   }
 
 private:
+#ifdef _M_X86_64
+  // x86-64 long double is the x87 80bit format, so these are just copies of the 10 bytes
+  static long double ToHost(X80SoftFloat const &Value) {
+    long double Result{};
+    memcpy(&Result, &Value, sizeof(X80SoftFloat));
+    return Result;
+  }
+
+  static X80SoftFloat FromHost(long double Value) {
+    X80SoftFloat Result;
+    memcpy(&Result, &Value, sizeof(X80SoftFloat));
+    return Result;
+  }
+
+  enum HostOpType {
+    Op_FRNDINT,
+    Op_F2XM1,
+    Op_FPTAN,
+    Op_FSIN,
+    Op_FCOS,
+    Op_FSQRT,
+    Op_FSCALE,
+    Op_FYL2X,
+    Op_FPATAN,
+  };
+
+  template<HostOpType Op>
+  static long double HostOp(long double Src) {
+    if constexpr (Op == Op_FRNDINT) asm("frndint" : "+t" (Src));
+    else if constexpr (Op == Op_F2XM1) asm("f2xm1" : "+t" (Src));
+    // fptan pushes a 1.0 on top of the result
+    else if constexpr (Op == Op_FPTAN) asm("fptan; fstp %%st(0)" : "+t" (Src));
+    else if constexpr (Op == Op_FSIN) asm("fsin" : "+t" (Src));
+    else if constexpr (Op == Op_FCOS) asm("fcos" : "+t" (Src));
+    else if constexpr (Op == Op_FSQRT) asm("fsqrt" : "+t" (Src));
+    return Src;
+  }
+
+  // Src1 goes in ST0, Src2 in ST1
+  template<HostOpType Op>
+  static long double HostBinaryOp(long double Src1, long double Src2) {
+    long double Result;
+    // fscale leaves ST1 alone, fyl2x and fpatan pop it
+    if constexpr (Op == Op_FSCALE) asm("fscale" : "=t" (Result) : "0" (Src1), "u" (Src2));
+    else if constexpr (Op == Op_FYL2X) asm("fyl2x" : "=t" (Result) : "0" (Src1), "u" (Src2) : "st(1)");
+    else if constexpr (Op == Op_FPATAN) asm("fpatan" : "=t" (Result) : "0" (Src1), "u" (Src2) : "st(1)");
+    return Result;
+  }
+
+  // Partial remainders, loop until C2 says the reduction is complete
+  static long double HostFPREM(long double lhs, long double rhs) {
+    asm("1: fprem; fnstsw %%ax; testw $0x400, %%ax; jnz 1b" : "+t" (lhs) : "u" (rhs) : "ax", "cc");
+    return lhs;
+  }
+
+  static long double HostFPREM1(long double lhs, long double rhs) {
+    asm("1: fprem1; fnstsw %%ax; testw $0x400, %%ax; jnz 1b" : "+t" (lhs) : "u" (rhs) : "ax", "cc");
+    return lhs;
+  }
+
+  static long double HostFXTRACT(long double Src, bool Exponent) {
+    long double Sig, Exp;
+    asm("fxtract" : "=t" (Sig), "=u" (Exp) : "0" (Src));
+    return Exponent ? Exp : Sig;
+  }
+
+  // Honours the rounding control like the guest's fist does, unlike a C cast
+  template<typename T>
+  static T HostFIST(long double Src) {
+    T Result;
+    if constexpr (sizeof(T) == 2) asm("fistps %0" : "=m" (Result) : "t" (Src) : "st");
+    else if constexpr (sizeof(T) == 4) asm("fistpl %0" : "=m" (Result) : "t" (Src) : "st");
+    else asm("fistpll %0" : "=m" (Result) : "t" (Src) : "st");
+    return Result;
+  }
+#endif
+
   static constexpr uint64_t IntegerBit = (1ULL << 63);
   static constexpr uint64_t Bottom62Significand = ((1ULL << 62) - 1);
   static constexpr uint32_t ExponentBias = 16383;
 };
 
 static_assert(sizeof(X80SoftFloat) == 10, "tword must be 10bytes in size");
+
+#undef X87_HOST_PATH
@@ -35,12 +35,28 @@ namespace FEXCore::Config {
     case FEXCore::Config::CONFIG_SMC_CHECKS:
       CTX->Config.SMCChecks = Config != 0;
     break;
+    case FEXCore::Config::CONFIG_X87SOFTFLOAT:
+      CTX->Config.X87SoftFloat = Config != 0;
+    break;
+    case FEXCore::Config::CONFIG_INTERPRETER_SWITCH:
+      CTX->Config.InterpreterSwitch = Config != 0;
+    break;
     case FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS:
       CTX->Config.ABILocalFlags = Config != 0;
     break;
     case FEXCore::Config::CONFIG_ABI_NO_PF:
       CTX->Config.ABINoPF = Config != 0;
     break;
+    case FEXCore::Config::CONFIG_OPT_LEVEL:
+      if (Config > FEXCore::IR::OPT_LEVEL_O2) {
+        LogMan::Msg::E("Unknown optimization level %ld, keeping O%d", Config, CTX->Config.OptLevel);
+        break;
+      }
+      CTX->Config.OptLevel = Config;
+    break;
+    case FEXCore::Config::CONFIG_PRIVATE_STACK:
+      CTX->Config.PrivateStack = Config != 0;
+    break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
   }
@@ -56,6 +72,18 @@ namespace FEXCore::Config {
     case FEXCore::Config::CONFIG_DUMPIR:
       CTX->Config.DumpIR = Config;
       break;
+    case FEXCore::Config::CONFIG_PASS_PIPELINE:
+      CTX->Config.PassPipeline = Config;
+      break;
+    case FEXCore::Config::CONFIG_HOSTFEATURES:
+      CTX->HostFeatures.ApplyOverride(Config);
+      break;
+    case FEXCore::Config::CONFIG_JITSYMBOLS:
+      CTX->Symbols.SetMode(Config);
+      break;
+    case FEXCore::Config::CONFIG_BLOCKPROFILE:
+      CTX->Config.BlockProfile = Config;
+      break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
   }
@@ -88,12 +116,24 @@ namespace FEXCore::Config {
     case FEXCore::Config::CONFIG_SMC_CHECKS:
       return CTX->Config.SMCChecks;
     break;
+    case FEXCore::Config::CONFIG_X87SOFTFLOAT:
+      return CTX->Config.X87SoftFloat;
+    break;
+    case FEXCore::Config::CONFIG_INTERPRETER_SWITCH:
+      return CTX->Config.InterpreterSwitch;
+    break;
     case FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS:
       return CTX->Config.ABILocalFlags;
     break;
     case FEXCore::Config::CONFIG_ABI_NO_PF:
       return CTX->Config.ABINoPF;
     break;
+    case FEXCore::Config::CONFIG_OPT_LEVEL:
+      return CTX->Config.OptLevel;
+    break;
+    case FEXCore::Config::CONFIG_PRIVATE_STACK:
+      return CTX->Config.PrivateStack;
+    break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
 
@@ -148,6 +148,14 @@ namespace Debug {
   void CompileRIP(FEXCore::Context::Context *CTX, uint64_t RIP) {
     CTX->CompileRIP(CTX->ParentThread, RIP);
   }
+  bool RunPassPipeline(FEXCore::Context::Context *CTX, FEXCore::IR::IREmitter *IREmit, std::string const &Pipeline) {
+    return CTX->RunPassPipeline(IREmit, Pipeline);
+  }
+
+  void CompileIR(FEXCore::Context::Context *CTX, FEXCore::IR::IREmitter *IREmit, bool JITCompile, CompileStats *Stats) {
+    CTX->CompileIR(IREmit, JITCompile, Stats);
+  }
+
   uint64_t GetThreadCount(FEXCore::Context::Context *CTX) {
     return CTX->GetThreadCount();
   }
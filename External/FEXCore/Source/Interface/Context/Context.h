@@ -8,11 +8,13 @@
 #include "Interface/IR/PassManager.h"
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CPUBackend.h>
+#include <FEXCore/Debug/ContextDebug.h>
 #include <FEXCore/Utils/Event.h>
 #include <stdint.h>
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace FEXCore {
 class ThunkHandler;
@@ -65,14 +67,24 @@ namespace FEXCore::Context {
 
       std::string DumpIR;
 
+      uint8_t OptLevel {FEXCore::IR::OPT_LEVEL_DEFAULT};
+      std::string PassPipeline;
+      bool PrivateStack {false};
+      std::string BlockProfile;
+      bool X87SoftFloat {false};
+      bool InterpreterSwitch {false};
+
     } Config;
 
     FEXCore::HostFeatures HostFeatures;
+    FEXCore::JITSymbols Symbols;
 
     std::mutex ThreadCreationMutex;
     uint64_t ThreadID{};
     FEXCore::Core::InternalThreadState* ParentThread;
     std::vector<FEXCore::Core::InternalThreadState*> Threads;
+    // Compile only thread used by offline tools, created on first use
+    std::unique_ptr<FEXCore::Core::InternalThreadState> OfflineThread;
     std::atomic_bool CoreShuttingDown{false};
 
     std::mutex IdleWaitMutex;
@@ -90,9 +102,7 @@ namespace FEXCore::Context {
     CustomCPUFactoryType FallbackCPUFactory;
     std::function<void(uint64_t ThreadId, FEXCore::Context::ExitReason)> CustomExitHandler;
 
-#ifdef BLOCKSTATS
     std::unique_ptr<FEXCore::BlockSamplingData> BlockData;
-#endif
 
     SignalDelegator *SignalDelegation{};
     X86GeneratedCode X86CodeGen;
@@ -123,6 +133,8 @@ namespace FEXCore::Context {
 
     // Debugger interface
     void CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
+    bool RunPassPipeline(FEXCore::IR::IREmitter *IREmit, std::string const &Pipeline);
+    void CompileIR(FEXCore::IR::IREmitter *IREmit, bool JITCompile, FEXCore::Context::Debug::CompileStats *Stats);
     uint64_t GetThreadCount() const;
     FEXCore::Core::RuntimeStats *GetRuntimeStatsForThread(uint64_t Thread);
     FEXCore::Core::CPUState GetCPUState();
@@ -136,6 +148,8 @@ namespace FEXCore::Context {
     void LoadEntryList();
 
     std::tuple<void *, FEXCore::Core::DebugData *> CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+    std::string GetSymbolDescription(uint64_t GuestRIP);
+    void RegisterJITSymbols(uint64_t GuestRIP, void *CodePtr, FEXCore::Core::DebugData const *DebugData);
     uintptr_t CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
     uintptr_t CompileFallbackBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
 
@@ -151,6 +165,13 @@ namespace FEXCore::Context {
 
   protected:
     void ClearCodeCache(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+    /**
+     * @brief Drops the block cache entries for code the backend is about to overwrite
+     *
+     * Entries that have since been remapped to newer code are left alone.
+     * KeepRIP is the block currently being compiled, its IR and debug data are still in use.
+     */
+    void EvictCodeBlocks(FEXCore::Core::InternalThreadState *Thread, std::vector<std::pair<uint64_t, uintptr_t>> const &Blocks, uint64_t KeepRIP);
 
   private:
     void WaitForIdleWithTimeout();
@@ -173,9 +194,6 @@ namespace FEXCore::Context {
     std::unique_ptr<GdbServer> DebugServer;
 
     bool StartPaused = false;
-#if ENABLE_JITSYMBOLS
-    FEXCore::JITSymbols Symbols;
-#endif
     FEXCore::Config::Value<std::string> AppFilename{FEXCore::Config::CONFIG_APP_FILENAME, ""};
   };
 
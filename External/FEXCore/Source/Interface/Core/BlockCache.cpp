@@ -1,6 +1,7 @@
 #include "Interface/Context/Context.h"
 #include "Interface/Core/Core.h"
 #include "Interface/Core/BlockCache.h"
+#include <cstring>
 #include <sys/mman.h>
 
 namespace FEXCore {
@@ -30,6 +31,9 @@ BlockCache::BlockCache(FEXCore::Context::Context *CTX)
   LogMan::Throw::A(PageMemory != -1ULL, "Failed to allocate page memory");
 
   VirtualMemSize = ctx->Config.VirtualMemSize;
+
+  BackingPage.resize(NUM_BACKINGS);
+  BackingEpoch.resize(NUM_BACKINGS);
 }
 
 BlockCache::~BlockCache() {
@@ -45,6 +49,33 @@ void BlockCache::HintUsedRange(uint64_t Address, uint64_t Size) {
   madvise(reinterpret_cast<void*>(PagePointer + Address), Size, MADV_WILLNEED);
 }
 
+uintptr_t BlockCache::EvictOldestBacking(uint64_t Page) {
+  size_t AllocatedBackings = AllocateOffset / SIZE_PER_PAGE;
+  if (AllocatedBackings == 0) {
+    return 0;
+  }
+
+  size_t Oldest = 0;
+  for (size_t i = 1; i < AllocatedBackings; ++i) {
+    if (BackingEpoch[i] < BackingEpoch[Oldest]) {
+      Oldest = i;
+    }
+  }
+
+  // Unhook the old page so the dispatcher misses and recompiles anything that ran from it
+  uintptr_t *Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
+  Pointers[BackingPage[Oldest]] = 0;
+
+  uintptr_t Backing = PageMemory + Oldest * SIZE_PER_PAGE;
+  memset(reinterpret_cast<void*>(Backing), 0, SIZE_PER_PAGE);
+
+  BackingPage[Oldest] = Page;
+  BackingEpoch[Oldest] = CurrentEpoch;
+  ++EvictedPages;
+
+  return Backing;
+}
+
 void BlockCache::ClearCache() {
   // Clear out the page memory
   madvise(reinterpret_cast<void*>(PagePointer), ctx->Config.VirtualMemSize / 4096 * 8, MADV_DONTNEED);
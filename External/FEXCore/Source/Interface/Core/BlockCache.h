@@ -2,6 +2,8 @@
 #include "Interface/Context/Context.h"
 #include <FEXCore/Utils/LogManager.h>
 
+#include <vector>
+
 namespace FEXCore {
 class BlockCache {
 public:
@@ -51,7 +53,7 @@ public:
     if (!LocalPagePointer) {
       // We don't have a page pointer for this address
       // Allocate one now if we can
-      uintptr_t NewPageBacking = AllocateBackingForPage();
+      uintptr_t NewPageBacking = AllocateBackingForPage(Address);
       if (!NewPageBacking) {
         // Couldn't allocate, return so the frontend can recover from this
         return 0;
@@ -68,6 +70,8 @@ public:
     BlockPointers[PageOffset].GuestCode = FullAddress;
     BlockPointers[PageOffset].HostCode = CastPtr;
 
+    BackingEpoch[(LocalPagePointer - PageMemory) / SIZE_PER_PAGE] = ++CurrentEpoch;
+
     return CastPtr;
   }
 
@@ -78,21 +82,33 @@ public:
   uintptr_t GetPagePointer() { return PagePointer; }
   uintptr_t GetVirtualMemorySize() const { return VirtualMemSize; }
 
+  /**
+   * @brief Number of guest pages that have had their mappings dropped to make room for another page
+   */
+  uint64_t GetEvictedPageCount() const { return EvictedPages; }
+
 private:
-  uintptr_t AllocateBackingForPage() {
+  uintptr_t AllocateBackingForPage(uint64_t Page) {
     uintptr_t NewBase = AllocateOffset;
     uintptr_t NewEnd = AllocateOffset + SIZE_PER_PAGE;
 
     if (NewEnd >= CODE_SIZE) {
-      // We ran out of block backing space. Need to clear the block cache and tell the JIT cores to clear their caches as well
-      // Tell whatever is calling this that it needs to do it.
-      return 0;
+      // We ran out of block backing space
+      // Steal the backing from the page that had a mapping added the longest time ago
+      // Lookups from the dispatcher's asm never come through here, so this is insertion order, not use
+      return EvictOldestBacking(Page);
     }
 
+    size_t Backing = NewBase / SIZE_PER_PAGE;
+    BackingPage[Backing] = Page;
+    BackingEpoch[Backing] = CurrentEpoch;
+
     AllocateOffset = NewEnd;
     return PageMemory + NewBase;
   }
 
+  uintptr_t EvictOldestBacking(uint64_t Page);
+
   uintptr_t FindCodePointerForAddress(uint64_t Address) {
     auto FullAddress = Address;
     Address = Address & (VirtualMemSize -1);
@@ -120,8 +136,15 @@ private:
 
   constexpr static size_t CODE_SIZE = 128 * 1024 * 1024;
   constexpr static size_t SIZE_PER_PAGE = 4096 * sizeof(BlockCacheEntry);
+  constexpr static size_t NUM_BACKINGS = CODE_SIZE / SIZE_PER_PAGE;
   size_t AllocateOffset {};
 
+  // Guest page each backing currently belongs to and when it last had a block added to it
+  std::vector<uint64_t> BackingPage;
+  std::vector<uint64_t> BackingEpoch;
+  uint64_t CurrentEpoch{};
+  uint64_t EvictedPages{};
+
   FEXCore::Context::Context *ctx;
   uint64_t VirtualMemSize{};
 };
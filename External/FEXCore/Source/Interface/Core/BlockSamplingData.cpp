@@ -1,51 +1,262 @@
+#include "Interface/Context/Context.h"
 #include "Interface/Core/BlockSamplingData.h"
+#include <FEXCore/Core/SignalDelegator.h>
 #include <FEXCore/Utils/LogManager.h>
-#include <cstring>
-#include <fstream>
+
+#include <algorithm>
+#include <signal.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+// Older glibc only exposes the thread id through the union member
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
 
 namespace FEXCore {
-  void BlockSamplingData::DumpBlockData() {
-    std::fstream Output;
-    Output.open("output.csv", std::fstream::out | std::fstream::binary);
+  thread_local BlockSamplingData::ThreadProfile *BlockSamplingData::CurrentProfile{};
+
+  BlockSamplingData::Mode BlockSamplingData::ParseMode(std::string_view Name) {
+    if (Name == "counters") {
+      return Mode::COUNTERS;
+    }
+    if (Name == "sampling") {
+      return Mode::SAMPLING;
+    }
+    return Mode::NONE;
+  }
+
+  BlockSamplingData::BlockSamplingData(FEXCore::Context::Context *ctx, Mode mode)
+    : CTX {ctx}
+    , ProfileMode {mode} {
+    if (ProfileMode == Mode::SAMPLING && CTX->SignalDelegation) {
+      CTX->SignalDelegation->RegisterHostSignalHandler(SIGPROF, [](FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) -> bool {
+        return HandleSample(Thread, info, ucontext);
+      });
+    }
+  }
+
+  BlockSamplingData::~BlockSamplingData() {
+    for (auto &Profile : Profiles) {
+      munmap(Profile->Counters, MAX_PROFILED_BLOCKS * sizeof(uint64_t));
+      if (Profile->Samples) {
+        munmap(Profile->Samples, SAMPLE_TABLE_SIZE * sizeof(Sample));
+      }
+    }
+  }
+
+  uint32_t BlockSamplingData::GetBlockIndex(uint64_t RIP) {
+    std::lock_guard<std::mutex> lk(ProfileMutex);
+    auto it = BlockIndices.find(RIP);
+    if (it != BlockIndices.end()) {
+      return it->second;
+    }
+
+    if (IndexToRIP.size() == MAX_PROFILED_BLOCKS) {
+      return NO_PROFILE_INDEX;
+    }
+
+    uint32_t Index = IndexToRIP.size();
+    IndexToRIP.emplace_back(RIP);
+    BlockIndices.emplace(RIP, Index);
+    return Index;
+  }
+
+  void BlockSamplingData::RegisterThread(FEXCore::Core::InternalThreadState *Thread) {
+    auto Profile = std::make_unique<ThreadProfile>();
+    Profile->Thread = Thread;
+
+    // Reserved up front so the JIT can use a fixed base, only the pages of blocks that run get backed
+    void *Counters = mmap(nullptr, MAX_PROFILED_BLOCKS * sizeof(uint64_t), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    LogMan::Throw::A(Counters != MAP_FAILED, "Couldn't allocate block profiling counters");
+    Profile->Counters = static_cast<uint64_t*>(Counters);
+
+    if (ProfileMode == Mode::SAMPLING) {
+      void *Samples = mmap(nullptr, SAMPLE_TABLE_SIZE * sizeof(Sample), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      LogMan::Throw::A(Samples != MAP_FAILED, "Couldn't allocate block profiling samples");
+      Profile->Samples = static_cast<Sample*>(Samples);
+    }
+
+    Thread->BlockCounters = Profile->Counters;
+
+    std::lock_guard<std::mutex> lk(ProfileMutex);
+    Profiles.emplace_back(std::move(Profile));
+  }
 
-    if (!Output.is_open())
+  BlockSamplingData::ThreadProfile *BlockSamplingData::GetProfile(FEXCore::Core::InternalThreadState *Thread) {
+    std::lock_guard<std::mutex> lk(ProfileMutex);
+    for (auto &Profile : Profiles) {
+      if (Profile->Thread == Thread) {
+        return Profile.get();
+      }
+    }
+    return nullptr;
+  }
+
+  void BlockSamplingData::StartSampling(FEXCore::Core::InternalThreadState *Thread) {
+    if (ProfileMode != Mode::SAMPLING || !CTX->SignalDelegation) {
       return;
+    }
 
-    Output << "Entry, Min, Max, Total, Calls, Average" << std::endl;
+    auto Profile = GetProfile(Thread);
+    if (!Profile) {
+      return;
+    }
 
-    for (auto it : SamplingMap) {
-      if (!it.second->TotalCalls)
-        continue;
+    // Timer runs on this thread's CPU time and signals only this thread
+    // The timer's value lets the handler tell our samples apart from the guest's own SIGPROF use
+    sigevent Event{};
+    Event.sigev_notify = SIGEV_THREAD_ID;
+    Event.sigev_signo = SIGPROF;
+    Event.sigev_value.sival_ptr = Profile;
+    Event.sigev_notify_thread_id = ::gettid();
 
-      Output << "0x" << std::hex << it.first
-             << ", " << std::dec << it.second->Min
-             << ", " << std::dec << it.second->Max
-             << ", " << std::dec << it.second->TotalTime
-             << ", " << std::dec << it.second->TotalCalls
-             << ", " << std::dec << ((double)it.second->TotalTime / (double)it.second->TotalCalls)
-             << std::endl;
+    CurrentProfile = Profile;
+
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &Event, &Profile->Timer) != 0) {
+      LogMan::Msg::E("Couldn't create block sampling timer");
+      return;
     }
-    Output.close();
-    LogMan::Msg::D("Dumped %d blocks of sampling data", SamplingMap.size());
+
+    itimerspec Period{};
+    Period.it_interval.tv_nsec = SAMPLE_PERIOD_NS;
+    Period.it_value = Period.it_interval;
+    timer_settime(Profile->Timer, 0, &Period, nullptr);
+    Profile->TimerActive = true;
   }
 
-  BlockSamplingData::BlockData *BlockSamplingData::GetBlockData(uint64_t RIP) {
-    auto it = SamplingMap.find(RIP);
-    if (it != SamplingMap.end()) {
-      return it->second;
+  void BlockSamplingData::StopSampling(FEXCore::Core::InternalThreadState *Thread) {
+    auto Profile = CurrentProfile;
+    if (Profile && Profile->Thread == Thread) {
+      // The profile stays current so a sample that was already in flight is still swallowed
+      if (Profile->TimerActive) {
+        timer_delete(Profile->Timer);
+        Profile->TimerActive = false;
+      }
+    }
+
+    // The thread is exiting, keep its counts for the dump but stop matching it
+    // A later thread can be allocated at the same address and must get its own profile
+    std::lock_guard<std::mutex> lk(ProfileMutex);
+    for (auto &Retired : Profiles) {
+      if (Retired->Thread == Thread) {
+        Retired->Thread = nullptr;
+      }
     }
-    BlockData *NewData = new BlockData{};
-    memset(NewData, 0, sizeof(BlockData));
-    NewData->Min = ~0ULL;
-    SamplingMap[RIP] = NewData;
-    return NewData;
   }
 
-  BlockSamplingData::~BlockSamplingData() {
-    DumpBlockData();
-    for (auto it : SamplingMap) {
-      delete it.second;
+  bool BlockSamplingData::HandleSample(FEXCore::Core::InternalThreadState *Thread, void *info, void *ucontext) {
+    auto SigInfo = static_cast<siginfo_t*>(info);
+    auto Profile = CurrentProfile;
+
+    // Anything other than our own timer belongs to the guest
+    if (!Profile ||
+        SigInfo->si_code != SI_TIMER ||
+        SigInfo->si_value.sival_ptr != Profile) {
+      return false;
+    }
+
+    auto Context = static_cast<ucontext_t*>(ucontext);
+#ifdef _M_X86_64
+    uint64_t HostPC = Context->uc_mcontext.gregs[REG_RIP];
+#elif defined(_M_ARM_64)
+    uint64_t HostPC = Context->uc_mcontext.pc;
+#else
+    uint64_t HostPC = 0;
+#endif
+
+    // The dispatcher keeps the RIP of the block being run in the state
+    // So while in JIT code that's the block the host PC belongs to
+    // The sample can land while the backend is swapping code buffers, so only the published ranges are safe to read
+    uint64_t Key = Thread->State.State.rip;
+    if (Thread->CPUBackend->IsAddressInPublishedCode(HostPC)) {
+      Key |= SAMPLE_IN_JIT;
+    }
+
+    uint64_t Count = 1 + SigInfo->si_overrun;
+    size_t Slot = (Key * 0x9E3779B97F4A7C15ULL) >> 50;
+    for (size_t i = 0; i < SAMPLE_TABLE_SIZE; ++i) {
+      auto &Entry = Profile->Samples[(Slot + i) & (SAMPLE_TABLE_SIZE - 1)];
+      if (Entry.Count == 0) {
+        Entry.Key = Key;
+        Entry.Count = Count;
+        return true;
+      }
+
+      if (Entry.Key == Key) {
+        Entry.Count += Count;
+        return true;
+      }
+    }
+
+    Profile->DroppedSamples += Count;
+    return true;
+  }
+
+  void BlockSamplingData::DumpBlockData() {
+    std::lock_guard<std::mutex> lk(ProfileMutex);
+
+    char Path[64];
+    snprintf(Path, sizeof(Path), "/tmp/fex-blocks-%d.folded", getpid());
+    FILE *Output = fopen(Path, "wb");
+    if (!Output) {
+      LogMan::Msg::E("Couldn't open block profile '%s'", Path);
+      return;
+    }
+
+    std::vector<uint64_t> Totals(IndexToRIP.size());
+    for (auto &Profile : Profiles) {
+      for (size_t i = 0; i < Totals.size(); ++i) {
+        Totals[i] += Profile->Counters[i];
+      }
+    }
+
+    std::vector<uint32_t> Order;
+    for (size_t i = 0; i < Totals.size(); ++i) {
+      if (Totals[i]) {
+        Order.emplace_back(i);
+      }
+    }
+    std::sort(Order.begin(), Order.end(), [&Totals](uint32_t a, uint32_t b) { return Totals[a] > Totals[b]; });
+
+    for (auto Index : Order) {
+      fprintf(Output, "%s %ld\n", CTX->GetSymbolDescription(IndexToRIP[Index]).c_str(), Totals[Index]);
+    }
+    fclose(Output);
+    LogMan::Msg::D("Dumped entry counts for %ld blocks to %s", Order.size(), Path);
+
+    if (ProfileMode != Mode::SAMPLING) {
+      return;
+    }
+
+    std::unordered_map<uint64_t, uint64_t> Samples;
+    uint64_t Dropped{};
+    for (auto &Profile : Profiles) {
+      for (size_t i = 0; i < SAMPLE_TABLE_SIZE; ++i) {
+        auto &Entry = Profile->Samples[i];
+        if (Entry.Count) {
+          Samples[Entry.Key] += Entry.Count;
+        }
+      }
+      Dropped += Profile->DroppedSamples;
+    }
+
+    snprintf(Path, sizeof(Path), "/tmp/fex-samples-%d.folded", getpid());
+    Output = fopen(Path, "wb");
+    if (!Output) {
+      LogMan::Msg::E("Couldn't open sample profile '%s'", Path);
+      return;
+    }
+
+    for (auto [Key, Count] : Samples) {
+      fprintf(Output, "%s;%s %ld\n",
+        CTX->GetSymbolDescription(Key & ~SAMPLE_IN_JIT).c_str(),
+        (Key & SAMPLE_IN_JIT) ? "[jit]" : "[fex]",
+        Count);
     }
-    SamplingMap.clear();
+    fclose(Output);
+    LogMan::Msg::D("Dumped %ld sample locations to %s, %ld samples dropped", Samples.size(), Path, Dropped);
   }
 }
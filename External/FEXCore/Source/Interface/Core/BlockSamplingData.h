@@ -1,23 +1,99 @@
 #pragma once
-#include <unordered_map>
+#include <memory>
+#include <mutex>
 #include <stdint.h>
+#include <string_view>
+#include <time.h>
+#include <unordered_map>
+#include <vector>
+
+namespace FEXCore::Context {
+  struct Context;
+}
+
+namespace FEXCore::Core {
+  struct InternalThreadState;
+}
 
 namespace FEXCore {
-class BlockSamplingData {
+/**
+ * @brief Guest block profiling that is cheap enough to leave enabled
+ *
+ * Every compiled block is given a dense index, and entering the block increments that slot
+ * in the running thread's counter array. Nothing else is touched on the hot path.
+ *
+ * With sampling enabled each thread also gets a SIGPROF timer on its own CPU time.
+ * Samples are bucketed by the guest RIP the thread is running and whether the host PC was in JIT code or in FEX itself.
+ *
+ * Results are written as folded stacks on shutdown, which flamegraph.pl and speedscope read directly.
+ */
+class BlockSamplingData final {
 public:
-  struct BlockData {
-    uint64_t Start, End;
-    uint64_t Min, Max;
-    uint64_t TotalTime;
-    uint64_t TotalCalls;
+  enum class Mode {
+    NONE,
+    COUNTERS,
+    SAMPLING,
   };
 
-  BlockData *GetBlockData(uint64_t RIP);
+  static Mode ParseMode(std::string_view Name);
+
+  static constexpr uint32_t NO_PROFILE_INDEX = ~0U;
+  static constexpr uint32_t MAX_PROFILED_BLOCKS = 1U << 20;
+
+  BlockSamplingData(FEXCore::Context::Context *ctx, Mode mode);
   ~BlockSamplingData();
 
+  /**
+   * @brief Returns the counter slot for a guest block, stable across recompiles
+   */
+  uint32_t GetBlockIndex(uint64_t RIP);
+
+  /**
+   * @brief Gives the thread its counter array, needs to happen before any of its code is compiled
+   */
+  void RegisterThread(FEXCore::Core::InternalThreadState *Thread);
+
+  /**
+   * @brief Starts and stops the sampling timer, must be called from the thread itself
+   *
+   * Stopping is done on thread exit, the thread's profile is kept for the dump but no longer belongs to it
+   */
+  void StartSampling(FEXCore::Core::InternalThreadState *Thread);
+  void StopSampling(FEXCore::Core::InternalThreadState *Thread);
+
   void DumpBlockData();
 
 private:
-  std::unordered_map<uint64_t, BlockData*> SamplingMap;
+  struct Sample {
+    uint64_t Key;
+    uint64_t Count;
+  };
+
+  struct ThreadProfile {
+    FEXCore::Core::InternalThreadState *Thread;
+    uint64_t *Counters;
+    Sample *Samples;
+    uint64_t DroppedSamples;
+    timer_t Timer;
+    bool TimerActive;
+  };
+
+  // Sample table is fixed size and open addressed so the signal handler never allocates
+  static constexpr size_t SAMPLE_TABLE_SIZE = 1U << 14;
+  static constexpr uint64_t SAMPLE_IN_JIT = 1ULL << 63;
+  static constexpr long SAMPLE_PERIOD_NS = 1'000'000;
+
+  FEXCore::Context::Context *CTX;
+  Mode ProfileMode;
+
+  std::mutex ProfileMutex;
+  std::unordered_map<uint64_t, uint32_t> BlockIndices;
+  std::vector<uint64_t> IndexToRIP;
+  std::vector<std::unique_ptr<ThreadProfile>> Profiles;
+
+  static thread_local ThreadProfile *CurrentProfile;
+
+  ThreadProfile *GetProfile(FEXCore::Core::InternalThreadState *Thread);
+  static bool HandleSample(FEXCore::Core::InternalThreadState *Thread, void *info, void *ucontext);
 };
 }
@@ -1,5 +1,6 @@
 #include "Common/MathUtils.h"
 #include "Common/Paths.h"
+#include "Common/SoftFloat.h"
 
 #include "Interface/Context/Context.h"
 #include "Interface/Core/BlockCache.h"
@@ -22,6 +23,8 @@
 
 #include "Interface/HLE/Thunks/Thunks.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <unistd.h>
 
@@ -130,9 +133,6 @@ namespace DefaultFallbackCore {
 namespace FEXCore::Context {
   Context::Context() {
     FallbackCPUFactory = FEXCore::Core::DefaultFallbackCore::CPUCreationFactory;
-#ifdef BLOCKSTATS
-    BlockData = std::make_unique<FEXCore::BlockSamplingData>();
-#endif
   }
 
   bool Context::GetFilenameHash(std::string const &Filename, std::string &Hash) {
@@ -217,6 +217,10 @@ namespace FEXCore::Context {
         AddThreadRIPsToEntryList(Thread);
       }
 
+      if (BlockData) {
+        BlockData->DumpBlockData();
+      }
+
       for (auto &Thread : Threads) {
 
         if (Thread->CompileService) {
@@ -234,6 +238,16 @@ namespace FEXCore::Context {
     ThunkHandler.reset(FEXCore::ThunkHandler::Create());
 
     LocalLoader = Loader;
+
+#ifdef _M_X86_64
+    X80SoftFloat::UseHostX87 = !Config.X87SoftFloat;
+#endif
+
+    auto ProfileMode = FEXCore::BlockSamplingData::ParseMode(Config.BlockProfile);
+    if (ProfileMode != FEXCore::BlockSamplingData::Mode::NONE) {
+      BlockData = std::make_unique<FEXCore::BlockSamplingData>(this, ProfileMode);
+    }
+
     using namespace FEXCore::Core;
     FEXCore::Core::CPUState NewThreadState{};
 
@@ -250,6 +264,7 @@ namespace FEXCore::Context {
     memset(NewThreadState.flags, 0, 32);
     NewThreadState.flags[1] = 1;
     NewThreadState.flags[9] = 1;
+    NewThreadState.FCW = 0x37F;
 
     FEXCore::Core::InternalThreadState *Thread = CreateThread(&NewThreadState, 0);
 
@@ -497,7 +512,7 @@ namespace FEXCore::Context {
         Stop(false /* Ignore current thread */);
     });
 
-    State->PassManager->AddDefaultPasses(Config.Core == FEXCore::Config::CONFIG_IRJIT);
+    State->PassManager->AddDefaultPasses(Config.Core == FEXCore::Config::CONFIG_IRJIT, Config.OptLevel, Config.PassPipeline, Config.PrivateStack);
     State->PassManager->AddDefaultValidationPasses();
 
     State->PassManager->RegisterSyscallHandler(SyscallHandler);
@@ -545,12 +560,18 @@ namespace FEXCore::Context {
 
     InitializeCompiler(Thread, false);
 
+    if (BlockData) {
+      BlockData->RegisterThread(Thread);
+    }
+
     LogMan::Throw::A(!Thread->FallbackBackend->NeedsOpDispatch(), "Fallback CPU backend must not require OpDispatch");
     return Thread;
   }
 
   uintptr_t Context::AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr) {
     auto BlockMapPtr = Thread->BlockCache->AddBlockMapping(Address, Ptr);
+    // Adding a mapping is the only thing that can steal a page backing
+    Thread->Stats.BlockCachePagesEvicted.store(Thread->BlockCache->GetEvictedPageCount(), std::memory_order_relaxed);
     if (BlockMapPtr == 0) {
       Thread->BlockCache->ClearCache();
 
@@ -562,6 +583,7 @@ namespace FEXCore::Context {
         Thread->IRLists.clear();
         Thread->IRLists.try_emplace(Address, IR);
       }
+      Thread->IntBackend->ClearCache();
       BlockMapPtr = Thread->BlockCache->AddBlockMapping(Address, Ptr);
       LogMan::Throw::A(BlockMapPtr, "Couldn't add mapping after clearing mapping cache");
     }
@@ -570,6 +592,14 @@ namespace FEXCore::Context {
   }
 
   void Context::ClearCodeCache(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
+    Thread->Stats.CodeCacheFlushes.fetch_add(1);
+    for (auto &IR : Thread->IRLists) {
+      if (IR.first != GuestRIP) {
+        Thread->EvictedBlocks.emplace(IR.first);
+        Thread->Stats.BlocksEvicted.fetch_add(1);
+      }
+    }
+
     Thread->BlockCache->ClearCache();
     Thread->CPUBackend->ClearCache();
     Thread->IntBackend->ClearCache();
@@ -588,6 +618,51 @@ namespace FEXCore::Context {
     }
   }
 
+  void Context::EvictCodeBlocks(FEXCore::Core::InternalThreadState *Thread, std::vector<std::pair<uint64_t, uintptr_t>> const &Blocks, uint64_t KeepRIP) {
+    Thread->Stats.CodeGenerationsEvicted.fetch_add(1);
+
+    for (auto [GuestRIP, HostCode] : Blocks) {
+      if (GuestRIP == KeepRIP) {
+        continue;
+      }
+
+      // Zero means the mapping was already removed or its page backing was stolen
+      // Anything else is a newer copy of the block living in another region
+      uintptr_t CurrentCode = Thread->BlockCache->FindBlock(GuestRIP);
+      if (CurrentCode != 0 && CurrentCode != HostCode) {
+        continue;
+      }
+
+      Thread->BlockCache->Erase(GuestRIP);
+      Thread->IRLists.erase(GuestRIP);
+      Thread->DebugData.erase(GuestRIP);
+      Thread->IntBackend->RemoveCodeEntry(GuestRIP);
+      Thread->EvictedBlocks.emplace(GuestRIP);
+      Thread->Stats.BlocksEvicted.fetch_add(1);
+    }
+  }
+
+  std::string Context::GetSymbolDescription(uint64_t GuestRIP) {
+    std::string Description;
+    if (!LocalLoader || !LocalLoader->GetSymbolDescription(GuestRIP, &Description)) {
+      char Address[24];
+      snprintf(Address, sizeof(Address), "0x%lx", GuestRIP);
+      Description = Address;
+    }
+    return Description;
+  }
+
+  void Context::RegisterJITSymbols(uint64_t GuestRIP, void *CodePtr, FEXCore::Core::DebugData const *DebugData) {
+    std::string Name = "guest:" + GetSymbolDescription(GuestRIP);
+    if (DebugData->Subblocks.size()) {
+      for (auto& Subblock: DebugData->Subblocks) {
+        Symbols.Register((void*)Subblock.HostCodeStart, Subblock.HostCodeSize, GuestRIP, Name);
+      }
+    } else {
+      Symbols.Register(CodePtr, DebugData->HostCodeSize, GuestRIP, Name);
+    }
+  }
+
   std::tuple<void *, FEXCore::Core::DebugData *> Context::CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
     uint8_t const *GuestCode{};
       GuestCode = reinterpret_cast<uint8_t const*>(GuestRIP);
@@ -627,38 +702,61 @@ namespace FEXCore::Context {
         Thread->OpDispatcher->StartNewBlock();
 
         uint64_t InstsInBlock = Block.NumInstructions;
-        for (size_t i = 0; i < InstsInBlock; ++i) {
-          FEXCore::X86Tables::X86InstInfo const* TableInfo {nullptr};
-          FEXCore::X86Tables::DecodedInst const* DecodedInfo {nullptr};
+        uint64_t BlockLength {};
+
+        // Validates [Offset, Offset + Length) of the block against the decoded code, 16 bytes per compare
+        // The last chunk overlaps the one before it rather than reading past the end of the range
+        // If anything changed the function is dropped and execution resumes at ResumeRIP, which recompiles from the new code
+        auto ValidateBlockCode = [&](uint64_t Offset, uint64_t Length, uint64_t ResumeRIP) {
+          IR::OrderedNode *CodeChanged {};
+          for (uint64_t ChunkStart = 0; ChunkStart < Length; ChunkStart += 16) {
+            uint64_t ChunkOffset = Offset + std::min(ChunkStart, Length > 16 ? Length - 16 : 0);
+            uint8_t ChunkLength = std::min<uint64_t>(Length, 16);
+            uintptr_t ExistingCodePtr = reinterpret_cast<uintptr_t>(Block.Entry + ChunkOffset);
+
+            __uint128_t existing {};
+            memcpy(&existing, (void*)(ExistingCodePtr), ChunkLength);
+            auto ChunkChanged = Thread->OpDispatcher->_ValidateCode(existing, ExistingCodePtr, ChunkLength);
+            CodeChanged = CodeChanged ? Thread->OpDispatcher->_Or(CodeChanged, ChunkChanged) : ChunkChanged;
+          }
 
-          TableInfo = Block.DecodedInstructions[i].TableInfo;
-          DecodedInfo = &Block.DecodedInstructions[i];
+          if (!CodeChanged) {
+            return;
+          }
 
-          if (Config.SMCChecks) {
-            __uint128_t existing;
+          auto InvalidateCodeCond = Thread->OpDispatcher->_CondJump(CodeChanged);
 
-            uintptr_t ExistingCodePtr{};
+          auto CodeWasChangedBlock = Thread->OpDispatcher->CreateNewCodeBlock();
+          Thread->OpDispatcher->SetTrueJumpTarget(InvalidateCodeCond, CodeWasChangedBlock);
 
-              ExistingCodePtr = reinterpret_cast<uintptr_t>(Block.Entry + BlockInstructionsLength);
+          Thread->OpDispatcher->SetCurrentCodeBlock(CodeWasChangedBlock);
+          Thread->OpDispatcher->_RemoveCodeEntry(GuestRIP);
+          Thread->OpDispatcher->_StoreContext(IR::GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), Thread->OpDispatcher->_Constant(ResumeRIP));
+          Thread->OpDispatcher->_ExitFunction();
 
-            memcpy(&existing, (void*)(ExistingCodePtr), DecodedInfo->InstSize);
-            auto CodeChanged = Thread->OpDispatcher->_ValidateCode(existing, ExistingCodePtr, DecodedInfo->InstSize);
+          auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlock();
 
-            auto InvalidateCodeCond = Thread->OpDispatcher->_CondJump(CodeChanged);
+          Thread->OpDispatcher->SetFalseJumpTarget(InvalidateCodeCond, NextOpBlock);
+          Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
+        };
 
-            auto CodeWasChangedBlock = Thread->OpDispatcher->CreateNewCodeBlock();
-            Thread->OpDispatcher->SetTrueJumpTarget(InvalidateCodeCond, CodeWasChangedBlock);
+        if (Config.SMCChecks) {
+          for (size_t i = 0; i < InstsInBlock; ++i) {
+            BlockLength += Block.DecodedInstructions[i].InstSize;
+          }
 
-            Thread->OpDispatcher->SetCurrentCodeBlock(CodeWasChangedBlock);
-            Thread->OpDispatcher->_RemoveCodeEntry(GuestRIP);
-            Thread->OpDispatcher->_StoreContext(IR::GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), Thread->OpDispatcher->_Constant(Block.Entry + BlockInstructionsLength));
-            Thread->OpDispatcher->_ExitFunction();
+          // Validate the whole block once at its entry
+          ValidateBlockCode(0, BlockLength, Block.Entry);
+        }
 
-            auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlock();
+        for (size_t i = 0; i < InstsInBlock; ++i) {
+          FEXCore::X86Tables::X86InstInfo const* TableInfo {nullptr};
+          FEXCore::X86Tables::DecodedInst const* DecodedInfo {nullptr};
 
-            Thread->OpDispatcher->SetFalseJumpTarget(InvalidateCodeCond, NextOpBlock);
-            Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
-          }
+          TableInfo = Block.DecodedInstructions[i].TableInfo;
+          DecodedInfo = &Block.DecodedInstructions[i];
+
+          uint32_t FirstInstNode = Thread->OpDispatcher->GetNodeCount();
 
           if (TableInfo->OpcodeDispatcher) {
             auto Fn = TableInfo->OpcodeDispatcher;
@@ -698,9 +796,19 @@ namespace FEXCore::Context {
             }
           }
 
+          bool SetRIP = Thread->OpDispatcher->HasSetRIP();
           if (Thread->OpDispatcher->FinishOp(DecodedInfo->PC + DecodedInfo->InstSize, i + 1 == InstsInBlock)) {
             break;
           }
+
+          // The entry check can't see a store in the block rewriting an instruction after it, so anything that writes
+          // guest memory checks the rest of the block again before it runs
+          if (Config.SMCChecks &&
+              !SetRIP &&
+              i + 1 < InstsInBlock &&
+              Thread->OpDispatcher->WritesGuestMemorySince(FirstInstNode)) {
+            ValidateBlockCode(BlockInstructionsLength, BlockLength - BlockInstructionsLength, Block.Entry + BlockInstructionsLength);
+          }
         }
       }
 
@@ -763,6 +871,9 @@ namespace FEXCore::Context {
       auto Debugit = &Thread->DebugData.try_emplace(GuestRIP).first->second;
       Debugit->GuestCodeSize = TotalInstructionsLength;
       Debugit->GuestInstructionCount = TotalInstructions;
+      if (BlockData) {
+        Debugit->ProfileIndex = BlockData->GetBlockIndex(GuestRIP);
+      }
 
       IRList = AddedIR.first->second.get();
       DebugData = Debugit;
@@ -785,6 +896,10 @@ namespace FEXCore::Context {
     FEXCore::Core::DebugData *DebugData;
     bool DecrementRefCount = false;
 
+    if (!Thread->EvictedBlocks.empty() && Thread->EvictedBlocks.erase(GuestRIP)) {
+      Thread->Stats.BlocksRecompiled.fetch_add(1);
+    }
+
     if (Thread->CompileBlockReentrantRefCount != 0) {
       if (!Thread->CompileService) {
         Thread->CompileService = std::make_shared<FEXCore::CompileService>(this, Thread);
@@ -807,17 +922,9 @@ namespace FEXCore::Context {
 
     if (CodePtr != nullptr) {
       // The core managed to compile the code.
-#if ENABLE_JITSYMBOLS
-      if (DebugData) {
-        if (DebugData->Subblocks.size()) {
-          for (auto& Subblock: DebugData->Subblocks) {
-            Symbols.Register((void*)Subblock.HostCodeStart, GuestRIP, Subblock.HostCodeSize);
-          }
-        } else {
-          Symbols.Register(CodePtr, GuestRIP, DebugData->HostCodeSize);
-        }
+      if (DebugData && Symbols.IsEnabled()) {
+        RegisterJITSymbols(GuestRIP, CodePtr, DebugData);
       }
-#endif
 
       if (DecrementRefCount)
         --Thread->CompileBlockReentrantRefCount;
@@ -871,8 +978,21 @@ namespace FEXCore::Context {
 
     Thread->State.RunningEvents.Running = true;
 
+    if (BlockData) {
+      BlockData->StartSampling(Thread);
+    }
+
     Thread->CPUBackend->ExecuteDispatch(Thread);
 
+    if (BlockData) {
+      BlockData->StopSampling(Thread);
+    }
+
+    // Profilers read the symbol file after the fact, don't leave this thread's blocks sitting in the batch
+    if (Symbols.IsEnabled()) {
+      Symbols.Flush();
+    }
+
     Thread->State.RunningEvents.WaitingToStart = false;
     Thread->State.RunningEvents.Running = false;
 
@@ -897,6 +1017,7 @@ namespace FEXCore::Context {
     Thread->IRLists.erase(GuestRIP);
     Thread->DebugData.erase(GuestRIP);
     Thread->BlockCache->Erase(GuestRIP);
+    Thread->IntBackend->RemoveCodeEntry(GuestRIP);
 
     if (Thread->CompileService) {
       Thread->CompileService->RemoveCodeEntry(GuestRIP);
@@ -912,6 +1033,7 @@ namespace FEXCore::Context {
     Thread->IRLists.erase(RIP);
     Thread->DebugData.erase(RIP);
     Thread->BlockCache->Erase(RIP);
+    Thread->IntBackend->RemoveCodeEntry(RIP);
 
     // We don't care if compilation passes or not
     CompileBlock(Thread, RIP);
@@ -919,6 +1041,55 @@ namespace FEXCore::Context {
     Thread->State.State.rip = RIPBackup;
   }
 
+  bool Context::RunPassPipeline(FEXCore::IR::IREmitter *IREmit, std::string const &Pipeline) {
+    FEXCore::IR::PassManager Manager;
+    Manager.RegisterSyscallHandler(SyscallHandler);
+
+    bool Result = Manager.AddDefaultPasses(Config.Core == FEXCore::Config::CONFIG_IRJIT, Config.OptLevel, Pipeline.empty() ? Config.PassPipeline : Pipeline, Config.PrivateStack);
+    Manager.AddDefaultValidationPasses();
+    Manager.Run(IREmit);
+
+    return Result;
+  }
+
+  void Context::CompileIR(FEXCore::IR::IREmitter *IREmit, bool JITCompile, FEXCore::Context::Debug::CompileStats *Stats) {
+    if (!OfflineThread) {
+      // Set up like a compile service thread, no dispatcher or signal handlers since nothing is executed
+      OfflineThread = std::make_unique<FEXCore::Core::InternalThreadState>();
+      InitializeCompiler(OfflineThread.get(), true);
+    }
+
+    auto Thread = OfflineThread.get();
+    *Stats = {};
+
+    auto PassStart = std::chrono::high_resolution_clock::now();
+    Thread->PassManager->Run(IREmit);
+    auto PassEnd = std::chrono::high_resolution_clock::now();
+    Stats->PassTime = std::chrono::duration_cast<std::chrono::nanoseconds>(PassEnd - PassStart).count();
+
+    auto RAPass = Thread->PassManager->GetRAPass();
+    if (RAPass) {
+      Stats->SpillSlots = RAPass->SpillSlots();
+    }
+
+    if (!JITCompile) {
+      return;
+    }
+
+    // The backend expects the IR to live in the thread's IR cache in case it needs to clear the code cache
+    uint64_t Entry = IREmit->ViewIR().GetHeader()->Entry;
+    auto IRList = Thread->IRLists.insert_or_assign(Entry, std::unique_ptr<FEXCore::IR::IRListView<true>>(IREmit->CreateIRCopy())).first->second.get();
+    FEXCore::Core::DebugData DebugData{};
+
+    auto CompileStart = std::chrono::high_resolution_clock::now();
+    Thread->CPUBackend->CompileCode(IRList, &DebugData);
+    auto CompileEnd = std::chrono::high_resolution_clock::now();
+    Stats->CompileTime = std::chrono::duration_cast<std::chrono::nanoseconds>(CompileEnd - CompileStart).count();
+    Stats->HostCodeSize = DebugData.HostCodeSize;
+
+    Thread->IRLists.erase(Entry);
+  }
+
   uint64_t Context::GetThreadCount() const {
     return Threads.size();
   }
@@ -1,5 +1,7 @@
 #include "Interface/Core/HostFeatures.h"
 
+#include <FEXCore/Utils/LogManager.h>
+
 #ifdef _M_ARM_64
 #include "aarch64/assembler-aarch64.h"
 #include "aarch64/cpu-aarch64.h"
@@ -11,6 +13,12 @@
 #include <xbyak/xbyak_util.h>
 #endif
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <string>
+#include <utility>
+
 namespace FEXCore {
 
 HostFeatures::HostFeatures() {
@@ -21,6 +29,80 @@ HostFeatures::HostFeatures() {
 #ifdef _M_X86_64
   Xbyak::util::Cpu Features{};
   SupportsAES = Features.has(Xbyak::util::Cpu::tAESNI);
+  SupportsCLMUL = Features.has(Xbyak::util::Cpu::tPCLMULQDQ);
+  SupportsSSE3 = Features.has(Xbyak::util::Cpu::tSSE3);
+  SupportsSSSE3 = Features.has(Xbyak::util::Cpu::tSSSE3);
+  SupportsSSE4_1 = Features.has(Xbyak::util::Cpu::tSSE41);
+  SupportsSSE4_2 = Features.has(Xbyak::util::Cpu::tSSE42);
+  SupportsPOPCNT = Features.has(Xbyak::util::Cpu::tPOPCNT);
+  SupportsLZCNT = Features.has(Xbyak::util::Cpu::tLZCNT);
+  SupportsBMI1 = Features.has(Xbyak::util::Cpu::tBMI1);
+  SupportsBMI2 = Features.has(Xbyak::util::Cpu::tBMI2);
+  // Xbyak only reports AVX when the OS saves the YMM state
+  SupportsAVX = Features.has(Xbyak::util::Cpu::tAVX);
+  SupportsAVX2 = Features.has(Xbyak::util::Cpu::tAVX2);
 #endif
 }
+
+void HostFeatures::ApplyOverride(std::string_view Features) {
+  const std::array<std::pair<std::string_view, bool HostFeatures::*>, 12> FeatureNames = {{
+    {"aes",    &HostFeatures::SupportsAES},
+    {"clmul",  &HostFeatures::SupportsCLMUL},
+    {"sse3",   &HostFeatures::SupportsSSE3},
+    {"ssse3",  &HostFeatures::SupportsSSSE3},
+    {"sse4.1", &HostFeatures::SupportsSSE4_1},
+    {"sse4.2", &HostFeatures::SupportsSSE4_2},
+    {"popcnt", &HostFeatures::SupportsPOPCNT},
+    {"lzcnt",  &HostFeatures::SupportsLZCNT},
+    {"bmi1",   &HostFeatures::SupportsBMI1},
+    {"bmi2",   &HostFeatures::SupportsBMI2},
+    {"avx",    &HostFeatures::SupportsAVX},
+    {"avx2",   &HostFeatures::SupportsAVX2},
+  }};
+
+  constexpr std::string_view Enable = "enable";
+  constexpr std::string_view Disable = "disable";
+
+  while (!Features.empty()) {
+    size_t End = Features.find(',');
+    std::string Option {Features.substr(0, End)};
+    Features.remove_prefix(End == std::string_view::npos ? Features.size() : End + 1);
+
+    std::transform(Option.begin(), Option.end(), Option.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (Option.empty()) {
+      continue;
+    }
+
+    std::string_view Name {Option};
+    bool Value;
+    if (Name.substr(0, Enable.size()) == Enable) {
+      Value = true;
+      Name.remove_prefix(Enable.size());
+    }
+    else if (Name.substr(0, Disable.size()) == Disable) {
+      Value = false;
+      Name.remove_prefix(Disable.size());
+    }
+    else {
+      LogMan::Msg::E("Host feature override '%s' needs to start with enable or disable", Option.c_str());
+      continue;
+    }
+
+    auto Feature = std::find_if(FeatureNames.begin(), FeatureNames.end(), [Name](auto const &Entry) {
+      return Entry.first == Name;
+    });
+
+    if (Feature == FeatureNames.end()) {
+      LogMan::Msg::E("Unknown host feature '%s'", Option.c_str());
+      continue;
+    }
+
+    this->*(Feature->second) = Value;
+  }
+
+  // BMI is VEX encoded but doesn't depend on the OS saving YMM state, AVX2 does
+  if (!SupportsAVX) {
+    SupportsAVX2 = false;
+  }
+}
 }
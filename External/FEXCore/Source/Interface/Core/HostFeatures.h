@@ -1,9 +1,30 @@
 #pragma once
 
+#include <string_view>
+
 namespace FEXCore {
 class HostFeatures final {
   public:
     HostFeatures();
+
+    /**
+     * @brief Forces features on or off, for testing codegen paths on any host
+     *
+     * @param Features Comma separated list of `enable<feature>`/`disable<feature>`, eg. "disablebmi2,disablelzcnt"
+     */
+    void ApplyOverride(std::string_view Features);
+
     bool SupportsAES{};
+    bool SupportsCLMUL{};
+    bool SupportsSSE3{};
+    bool SupportsSSSE3{};
+    bool SupportsSSE4_1{};
+    bool SupportsSSE4_2{};
+    bool SupportsPOPCNT{};
+    bool SupportsLZCNT{};
+    bool SupportsBMI1{};
+    bool SupportsBMI2{};
+    bool SupportsAVX{};
+    bool SupportsAVX2{};
 };
 }
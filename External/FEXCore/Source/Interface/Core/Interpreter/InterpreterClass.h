@@ -7,6 +7,10 @@
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace FEXCore::CPU {
 class DispatchGenerator;
 
@@ -30,6 +34,9 @@ public:
 
   void ExecuteCode(FEXCore::Core::InternalThreadState *Thread);
 
+  void ClearCache() override;
+  void RemoveCodeEntry(uint64_t GuestRIP) override;
+
   void CreateAsmDispatch(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread);
   void DeleteAsmDispatch();
 
@@ -37,6 +44,55 @@ public:
   CallbackReturn ReturnPtr;
 
 private:
+  /**
+   * @brief A single IR op lowered for threaded dispatch
+   *
+   * Handler is the address of the op's label inside of ExecuteCode, filled in the first time the program runs.
+   * Args holds the SSA slot index of each operand, so handlers index the SSA data without going back through the IR op.
+   * The SSA data lives on ExecuteCode's stack, so an index is as far as an operand can be resolved ahead of time.
+   * Branch targets are resolved to indices in the program so jumps don't walk the IR.
+   * Ops that leave the program keep the index of their SuccessorLink in Target[0].
+   */
+  struct DecodedOp {
+    // Syscall has the most SSA arguments of any op
+    static constexpr size_t MAX_ARGS = 7;
+
+    void const *Handler;
+    IR::IROp_Header const *IROp;
+    IR::OrderedNodeWrapper Node;
+    uint32_t Target[2];
+    uint32_t Args[MAX_ARGS];
+  };
+
+  struct DecodedProgram;
+
+  /**
+   * @brief Where an exit went last time, a null Program means the target has native code
+   *
+   * Only valid while Epoch matches the interpreter's LinkEpoch, any removal invalidates all links.
+   */
+  struct SuccessorLink {
+    uint64_t RIP;
+    DecodedProgram *Program;
+    uint64_t Epoch;
+  };
+
+  /**
+   * @brief All the blocks of a multiblock laid out in IR order, finished with an op that leaves ExecuteCode
+   *
+   * Everything the interpreter needs per execution is captured here when decoding so entering a block doesn't touch any maps.
+   */
+  struct DecodedProgram {
+    FEXCore::IR::IRListView<true> const *Source;
+    std::vector<DecodedOp> Ops;
+    std::vector<SuccessorLink> Links;
+    uint32_t SSACount;
+    uint32_t ProfileIndex;
+    uint64_t GuestInstructionCount;
+    // Only programs with x87 ops need the guest's control word loaded
+    bool UsesF80;
+  };
+
   FEXCore::Context::Context *CTX;
   FEXCore::Core::InternalThreadState *State;
 
@@ -48,7 +104,24 @@ private:
   Res GetDest(void* SSAData, IR::OrderedNodeWrapper Op);
 
   template<typename Res>
-  Res GetSrc(void* SSAData, IR::OrderedNodeWrapper Src);
+  Res GetSrc(void* SSAData, uint32_t Slot);
+
+  std::unique_ptr<DecodedProgram> DecodeProgram(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData const *DebugData);
+  void FlushStats();
+
+  std::unordered_map<uint64_t, std::unique_ptr<DecodedProgram>> DecodedPrograms;
+  // Removed programs might still be running, they get freed on the next entry in to the interpreter
+  std::vector<std::unique_ptr<DecodedProgram>> RetiredPrograms;
+  // Starts at one so value initialized links are never valid
+  uint64_t LinkEpoch{1};
+
+  // Executed instruction count is batched here so the shared atomic is only touched every so often
+  static constexpr uint64_t STATS_FLUSH_THRESHOLD = 1U << 16;
+  uint64_t PendingInstructions{};
+
+  // x87 control word that the F80 ops are currently set up for, only reapplied when the guest's changes
+  // Reset on every entry since the host's own control word is restored on the way out, ~0U while nothing was applied
+  uint32_t AppliedFCW{~0U};
 
   DispatchGenerator *Generator{};
 };
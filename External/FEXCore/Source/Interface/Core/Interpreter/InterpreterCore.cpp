@@ -2,22 +2,27 @@
 #include "Common/SoftFloat.h"
 #include "Interface/Context/Context.h"
 #include "Interface/Core/BlockCache.h"
+#include "Interface/Core/BlockSamplingData.h"
 #include "Interface/Core/DebugData.h"
 #include "Interface/Core/InternalThreadState.h"
 #include "Interface/Core/Interpreter/InterpreterClass.h"
 #include <FEXCore/Utils/LogManager.h>
 
 #include <FEXCore/Core/CPUBackend.h>
+#include <FEXCore/Core/X86Enums.h>
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
 #include "Interface/HLE/Thunks/Thunks.h"
 
+#include <array>
 #include <atomic>
+#include <cerrno>
 #include <cmath>
 #include <limits>
 #include <vector>
+#include <unistd.h>
 #ifdef _M_X86_64
 #include <xmmintrin.h>
 #endif
@@ -422,6 +427,11 @@ InterpreterCore::~InterpreterCore() {
   DeleteAsmDispatch();
 }
 
+void InterpreterCore::FlushStats() {
+  State->Stats.InstructionsExecuted.fetch_add(PendingInstructions, std::memory_order_relaxed);
+  PendingInstructions = 0;
+}
+
 template<typename Res>
 Res InterpreterCore::GetDest(void* SSAData, IR::OrderedNodeWrapper Op) {
   auto DstPtr = &reinterpret_cast<__uint128_t*>(SSAData)[Op.ID()];
@@ -429,8 +439,8 @@ Res InterpreterCore::GetDest(void* SSAData, IR::OrderedNodeWrapper Op) {
 }
 
 template<typename Res>
-Res InterpreterCore::GetSrc(void* SSAData, IR::OrderedNodeWrapper Src) {
-  auto DstPtr = &reinterpret_cast<__uint128_t*>(SSAData)[Src.ID()];
+Res InterpreterCore::GetSrc(void* SSAData, uint32_t Slot) {
+  auto DstPtr = &reinterpret_cast<__uint128_t*>(SSAData)[Slot];
   return reinterpret_cast<Res>(DstPtr);
 }
 
@@ -438,27 +448,211 @@ void *InterpreterCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true
   return reinterpret_cast<void*>(InterpreterExecution);
 }
 
+void InterpreterCore::ClearCache() {
+  FlushStats();
+  ++LinkEpoch;
+
+  for (auto &Program : DecodedPrograms) {
+    RetiredPrograms.emplace_back(std::move(Program.second));
+  }
+  DecodedPrograms.clear();
+}
+
+void InterpreterCore::RemoveCodeEntry(uint64_t GuestRIP) {
+  // Other programs might link to this one, or have cached that it was native
+  ++LinkEpoch;
+
+  auto Program = DecodedPrograms.find(GuestRIP);
+  if (Program != DecodedPrograms.end()) {
+    RetiredPrograms.emplace_back(std::move(Program->second));
+    DecodedPrograms.erase(Program);
+  }
+}
+
+std::unique_ptr<InterpreterCore::DecodedProgram> InterpreterCore::DecodeProgram(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData const *DebugData) {
+  using namespace FEXCore::IR;
+
+  auto Program = std::make_unique<DecodedProgram>();
+  Program->Source = IR;
+  // Slot zero is the IR header, the exit op clears it like any other op
+  Program->SSACount = 1;
+  Program->ProfileIndex = DebugData ? DebugData->ProfileIndex : BlockSamplingData::NO_PROFILE_INDEX;
+  Program->GuestInstructionCount = DebugData ? DebugData->GuestInstructionCount : 0;
+  Program->UsesF80 = false;
+
+  uintptr_t ListBegin = IR->GetListData();
+  std::vector<uint32_t> BlockStart(IR->GetSSACount());
+  std::vector<uint32_t> Branches;
+
+  for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
+    LogMan::Throw::A(BlockHeader->Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+    BlockStart[BlockNode->Wrapped(ListBegin).ID()] = Program->Ops.size();
+
+    for (auto [CodeNode, IROp] : IR->GetCode(BlockNode)) {
+      switch (IROp->Op) {
+        // Nothing to execute, don't spend a dispatch on them
+        case IR::OP_DUMMY:
+        case IR::OP_BEGINBLOCK:
+        case IR::OP_ENDBLOCK:
+        case IR::OP_INVALIDATEFLAGS:
+          continue;
+        case IR::OP_CONDJUMP:
+        case IR::OP_JUMP:
+          Branches.emplace_back(Program->Ops.size());
+          break;
+        case IR::OP_F80ADD:
+        case IR::OP_F80SUB:
+        case IR::OP_F80MUL:
+        case IR::OP_F80DIV:
+        case IR::OP_F80ATAN:
+        case IR::OP_F80FPREM:
+        case IR::OP_F80FPREM1:
+        case IR::OP_F80SCALE:
+        case IR::OP_F80CVT:
+        case IR::OP_F80CVTINT:
+        case IR::OP_F80CVTTO:
+        case IR::OP_F80CVTTOINT:
+        case IR::OP_F80ROUND:
+        case IR::OP_F80F2XM1:
+        case IR::OP_F80FYL2X:
+        case IR::OP_F80TAN:
+        case IR::OP_F80SQRT:
+        case IR::OP_F80SIN:
+        case IR::OP_F80COS:
+        case IR::OP_F80XTRACT_EXP:
+        case IR::OP_F80XTRACT_SIG:
+        case IR::OP_F80CMP:
+        case IR::OP_F80BCDLOAD:
+        case IR::OP_F80BCDSTORE:
+        case IR::OP_F80LOADFCW:
+          Program->UsesF80 = true;
+          break;
+        default: break;
+      }
+
+      auto Node = CodeNode->Wrapped(ListBegin);
+      Program->SSACount = std::max(Program->SSACount, Node.ID() + 1);
+      auto &Op = Program->Ops.emplace_back(DecodedOp{nullptr, IROp, Node, {}, {}});
+
+      LogMan::Throw::A(IROp->NumArgs <= DecodedOp::MAX_ARGS, "Too many arguments for a decoded op: %d", IROp->NumArgs);
+      for (uint8_t i = 0; i < IROp->NumArgs; ++i) {
+        Op.Args[i] = IROp->Args[i].ID();
+      }
+
+      if (IROp->Op == IR::OP_EXITFUNCTION) {
+        Program->Ops.back().Target[0] = Program->Links.size();
+        Program->Links.emplace_back();
+      }
+    }
+  }
+
+  // Falling off the end of the last block leaves the interpreter, the header op is linked to the exit
+  Program->Ops.emplace_back(DecodedOp{nullptr, &IR->GetHeader()->Header, OrderedNodeWrapper::WrapOffset(0), {static_cast<uint32_t>(Program->Links.size())}});
+  Program->Links.emplace_back();
+
+  for (auto Index : Branches) {
+    auto &Op = Program->Ops[Index];
+    if (Op.IROp->Op == IR::OP_JUMP) {
+      Op.Target[0] = BlockStart[Op.IROp->C<IR::IROp_Jump>()->Header.Args[0].ID()];
+    }
+    else {
+      auto CondJump = Op.IROp->C<IR::IROp_CondJump>();
+      Op.Target[0] = BlockStart[CondJump->TrueBlock.ID()];
+      Op.Target[1] = BlockStart[CondJump->FalseBlock.ID()];
+    }
+  }
+
+  return Program;
+}
+
+// Every op with a handler in ExecuteCode, used to build the threaded dispatch table
+#define INTERPRETER_OPS(X) \
+  X(VALIDATECODE) X(REMOVECODEENTRY) X(DUMMY) X(BEGINBLOCK) X(ENDBLOCK) X(INVALIDATEFLAGS) \
+  X(FENCE) X(EXITFUNCTION) X(CONDJUMP) X(JUMP) X(BREAK) X(SIGNALRETURN) \
+  X(CALLBACKRETURN) X(SYSCALL) X(DIRECTSYSCALL) X(INLINESYSCALL) X(THUNK) X(CPUID) \
+  X(PRINT) X(CYCLECOUNTER) X(MOV) X(VBITCAST) X(VCASTFROMGPR) X(VEXTRACTTOGPR) \
+  X(VEXTRACTELEMENT) X(CONSTANT) X(VECTORZERO) X(LOADCONTEXT) X(LOADCONTEXTINDEXED) X(STORECONTEXT) \
+  X(STORECONTEXTINDEXED) X(LOADCONTEXTPAIR) X(STORECONTEXTPAIR) X(CREATEELEMENTPAIR) X(EXTRACTELEMENTPAIR) X(CASPAIR) \
+  X(TRUNCELEMENTPAIR) X(LOADFLAG) X(STOREFLAG) X(LOADMEM) X(LOADMEMTSO) X(VLOADMEMELEMENT) \
+  X(STOREMEM) X(STOREMEMTSO) X(VSTOREMEMELEMENT) X(ADD) X(SUB) X(NEG) \
+  X(OR) X(AND) X(XOR) X(LSHL) X(LSHR) X(ASHR) \
+  X(ROR) X(EXTR) X(NOT) X(MUL) X(MULH) X(UMUL) \
+  X(UMULH) X(DIV) X(UDIV) X(REM) X(UREM) X(POPCOUNT) \
+  X(FINDLSB) X(FINDMSB) X(REV) X(FINDTRAILINGZEROS) X(COUNTLEADINGZEROES) X(BFI) \
+  X(SBFE) X(BFE) X(SELECT) X(CAS) X(ATOMICADD) X(ATOMICSUB) \
+  X(ATOMICAND) X(ATOMICOR) X(ATOMICXOR) X(ATOMICSWAP) X(ATOMICFETCHADD) X(ATOMICFETCHSUB) \
+  X(ATOMICFETCHAND) X(ATOMICFETCHOR) X(ATOMICFETCHXOR) X(CREATEVECTOR2) X(SPLATVECTOR4) X(SPLATVECTOR2) \
+  X(VMOV) X(VOR) X(VAND) X(VXOR) X(VSLI) X(VSRI) \
+  X(VNOT) X(VECTORIMM) X(VNEG) X(VFNEG) X(VUSHRI) X(VSSHRI) \
+  X(VSHLI) X(VADD) X(VSUB) X(VUQADD) X(VUQSUB) X(VSQADD) \
+  X(VSQSUB) X(VFADD) X(VFADDP) X(VFSUB) X(VADDP) X(VADDV) \
+  X(VURAVG) X(VABS) X(VFMUL) X(VFDIV) X(VFMIN) X(VFMAX) \
+  X(VFRECP) X(VFSQRT) X(VFRSQRT) X(VUSHRNI) X(VUSHRNI2) X(VSQXTN) \
+  X(VSQXTN2) X(VSQXTUN) X(VSQXTUN2) X(VECTOR_UTOF) X(VECTOR_STOF) X(VECTOR_FTOZU) \
+  X(VECTOR_FTOZS) X(VECTOR_FTOU) X(VECTOR_FTOS) X(VUMUL) X(VSMUL) X(VUMULL) \
+  X(VSMULL) X(VUMULL2) X(VSMULL2) X(VSXTL) X(VSXTL2) X(VUXTL) \
+  X(VUXTL2) X(VUMIN) X(VSMIN) X(VUMAX) X(VSMAX) X(VUSHL) \
+  X(VSSHR) X(VUSHLS) X(VUSHRS) X(VSSHRS) X(VUSHR) X(VZIP2) \
+  X(VZIP) X(VINSELEMENT) X(VINSSCALARELEMENT) X(VBSL) X(VCMPEQ) X(VCMPEQZ) \
+  X(VCMPGT) X(VCMPGTZ) X(VCMPLTZ) X(LUDIV) X(LDIV) X(LUREM) \
+  X(LREM) X(VEXTR) X(VINSGPR) X(FLOAT_FROMGPR_S) X(FLOAT_FROMGPR_U) X(FLOAT_TOGPR_ZS) \
+  X(FLOAT_TOGPR_ZU) X(FLOAT_TOGPR_S) X(FLOAT_TOGPR_U) X(FLOAT_FTOF) X(VECTOR_FTOF) X(FCMP) \
+  X(VTBL1) X(GETHOSTFLAG) X(HOSTFLAGS) X(VFCMPEQ) X(VFCMPNEQ) X(VFCMPLT) \
+  X(VFCMPLE) X(VFCMPUNO) X(VFCMPORD) X(VAESIMC) X(VAESENC) X(VAESENCLAST) \
+  X(VAESDEC) X(VAESDECLAST) X(VAESKEYGENASSIST) X(F80ADD) X(F80SUB) X(F80MUL) \
+  X(F80DIV) X(F80FYL2X) X(F80ATAN) X(F80FPREM1) X(F80FPREM) X(F80SCALE) \
+  X(F80CVT) X(F80CVTINT) X(F80CVTTO) X(F80CVTTOINT) X(F80ROUND) X(F80F2XM1) \
+  X(F80TAN) X(F80SQRT) X(F80SIN) X(F80COS) X(F80XTRACT_EXP) X(F80XTRACT_SIG) \
+  X(F80CMP) X(GETROUNDINGMODE) X(SETROUNDINGMODE) X(F80BCDLOAD) X(F80BCDSTORE) X(F80LOADFCW)
+
+// Handlers are still switch cases so that a `break` finishes the op, the label is what the dispatch table points at
+#define IROP_CASE(x) case IR::OP_##x: Op_##x
+
 void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
   volatile void* stack = alloca(0);
-  auto IR = Thread->IRLists.find(Thread->State.State.rip);
-  auto CurrentIR = IR->second.get();
 
-  uintptr_t ListSize = CurrentIR->GetSSACount();
+  // Decoding happens here on first execution rather than in CompileCode
+  // Blocks that fall back from the JIT never went through our CompileCode, and a block compiled by the compile service
+  // went through another backend's CompileCode with an IR copy that is freed once the work item is done
+  // Every path that removes a block's IR also removes its program, so a hit doesn't need to check the IR
+  // Returns nullptr if the block hasn't been compiled yet or, when chaining, if it has native code
+  auto FindProgram = [&](uint64_t RIP, bool Chaining) -> DecodedProgram* {
+    auto Decoded = DecodedPrograms.find(RIP);
+    if (Decoded != DecodedPrograms.end()) {
+      return Decoded->second.get();
+    }
 
-  uintptr_t ListBegin = CurrentIR->GetListData();
-  uintptr_t DataBegin = CurrentIR->GetData();
+    auto IR = Thread->IRLists.find(RIP);
+    if (IR == Thread->IRLists.end()) {
+      return nullptr;
+    }
 
-  static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
-  static_assert(sizeof(FEXCore::IR::OrderedNode) == 16);
+    if (Chaining && Thread->CPUBackend.get() != this && !IR->second->GetHeader()->ShouldInterpret) {
+      return nullptr;
+    }
 
-  auto BlockIterator = CurrentIR->GetBlocks().begin();
-  auto BlockEnd = CurrentIR->GetBlocks().end();
+    auto DebugData = Thread->DebugData.find(RIP);
+    auto NewProgram = DecodeProgram(IR->second.get(), DebugData != Thread->DebugData.end() ? &DebugData->second : nullptr);
+    auto Program = NewProgram.get();
+    DecodedPrograms.insert_or_assign(RIP, std::move(NewProgram));
+    return Program;
+  };
 
-  // Allocate 16 bytes per SSA
-  void *SSAData = alloca(ListSize * 16);
+  // With a gdb server attached the dispatcher needs to see every block so single stepping works
+  bool ChainBlocks = !CTX->GetGdbServerStatus();
+  bool ThreadedDispatch = !CTX->Config.InterpreterSwitch;
 
-  // Clear them all to zero. Required for Zero-extend semantics
-  memset(SSAData, 0, ListSize * 16);
+  DecodedProgram *Program = FindProgram(Thread->State.State.rip, false);
+  FEXCore::IR::IRListView<true> const *CurrentIR{};
+
+  static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
+  static_assert(sizeof(FEXCore::IR::OrderedNode) == 16);
+
+  // 16 bytes per SSA, only up to the last node that is executed
+  // Not cleared up front, each op clears its own slot before it runs which keeps the zero-extend semantics
+  // Reused by chained blocks, grows geometrically so chaining can't keep eating stack
+  __uint128_t *SSAData{};
+  uint32_t SSACapacity{};
 
 #define GD *GetDest<uint64_t*>(SSAData, WrapperOp)
 #define GDP GetDest<void*>(SSAData, WrapperOp)
@@ -467,27 +661,86 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
     return IROp->Size;
   };
 
+  // The guest's control word only stays loaded in to the host x87 unit while we are in here
+  // Syscalls and other FEX code called from an op still see the guest's precision and rounding
+  // Only loaded once a program with x87 ops runs, so integer and SSE only code never touches the control word
+  AppliedFCW = ~0U;
+
   while (1) {
-    using namespace FEXCore::IR;
-    auto [BlockNode, BlockHeader] = BlockIterator();
-    auto BlockIROp = BlockHeader->CW<IROp_CodeBlock>();
-    LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
-
-    // We grab these nodes this way so we can iterate easily
-    auto CodeBegin = CurrentIR->at(BlockIROp->Begin);
-    auto CodeLast = CurrentIR->at(BlockIROp->Last);
-    struct {
-      bool Quit;
-      bool Redo;
-    } BlockResults{};
-
-    auto HandleBlock = [&](OrderedNode *BlockNode) {
-      for (auto [CodeNode, IROp] : CurrentIR->GetCode(BlockNode)) {
-        OrderedNodeWrapper WrapperOp = CodeNode->Wrapped(ListBegin);
-        uint8_t OpSize = IROp->Size;
+    // Nothing can be running out of a retired program between blocks
+    RetiredPrograms.clear();
+
+    CurrentIR = Program->Source;
+
+    // Catches FCW changes made outside of the interpreter, like an FXRSTOR in a JIT block
+    if (Program->UsesF80 && Thread->State.State.FCW != AppliedFCW) {
+      AppliedFCW = Thread->State.State.FCW;
+      X80SoftFloat::SetControlWord(AppliedFCW);
+    }
+
+    if (Thread->BlockCounters && Program->ProfileIndex != BlockSamplingData::NO_PROFILE_INDEX) {
+      ++Thread->BlockCounters[Program->ProfileIndex];
+    }
+
+    if (Program->SSACount > SSACapacity) {
+      SSACapacity = std::max(Program->SSACount, SSACapacity * 2);
+      SSAData = static_cast<__uint128_t*>(alloca(SSACapacity * 16));
+    }
 
+    // Runs the program until one of its exits and returns the op that left
+    // The handler labels only exist in here, so this is also where programs get linked to them
+    auto RunProgram = [&]() -> DecodedOp const* {
+      static std::array<void const*, IR::IROps::OP_LAST> const DispatchTable = ({
+        std::array<void const*, IR::IROps::OP_LAST> Table;
+        Table.fill(&&Op_Unhandled);
+#define IROP_DISPATCH(x) Table[IR::OP_##x] = &&Op_##x;
+        INTERPRETER_OPS(IROP_DISPATCH)
+#undef IROP_DISPATCH
+        // The IR header is the program's trailing exit op
+        Table[IR::OP_IRHEADER] = &&ProgramExit;
+        Table;
+      });
+
+      // Every op goes through the switch, only kept around to measure threaded dispatch against
+      static std::array<void const*, IR::IROps::OP_LAST> const SwitchTable = ({
+        std::array<void const*, IR::IROps::OP_LAST> Table;
+        Table.fill(&&SwitchDispatch);
+        Table[IR::OP_IRHEADER] = &&ProgramExit;
+        Table;
+      });
+
+      if (!Program->Ops.front().Handler) {
+        auto &Table = ThreadedDispatch ? DispatchTable : SwitchTable;
+        for (auto &Op : Program->Ops) {
+          Op.Handler = Table[Op.IROp->Op];
+        }
+      }
+
+      using namespace FEXCore::IR;
+      DecodedOp const *PC = Program->Ops.data();
+      DecodedOp const *CurrentOp{};
+      IROp_Header const *IROp{};
+      OrderedNodeWrapper WrapperOp{};
+      uint8_t OpSize{};
+
+      // Every handler ends by dispatching the next op itself, giving each handler its own indirect branch to predict
+#define NEXT() \
+      do { \
+        CurrentOp = PC++; \
+        IROp = CurrentOp->IROp; \
+        WrapperOp = CurrentOp->Node; \
+        OpSize = IROp->Size; \
+        SSAData[WrapperOp.ID()] = 0; \
+        goto *CurrentOp->Handler; \
+      } while (0)
+
+      while (1) {
+        // Only reached on entry and by handlers that break out early
+        NEXT();
+
+      SwitchDispatch:
         switch (IROp->Op) {
-          case IR::OP_VALIDATECODE: {
+          IROP_CASE(VALIDATECODE): {
             auto Op = IROp->C<IR::IROp_ValidateCode>();
 
             if (memcmp((void*)Op->CodePtr, &Op->CodeOriginal, Op->CodeLength) != 0) {
@@ -495,21 +748,21 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             } else {
               GD = 0;
             }
-            break;
+            NEXT();
           }
 
-          case IR::OP_REMOVECODEENTRY: {
+          IROP_CASE(REMOVECODEENTRY): {
             auto Op = IROp->C<IR::IROp_RemoveCodeEntry>();
             CTX->RemoveCodeEntry(Thread, Op->RIP);
-            break;
+            NEXT();
           }
 
-          case IR::OP_DUMMY:
-          case IR::OP_BEGINBLOCK:
-          case IR::OP_ENDBLOCK:
-          case IR::OP_INVALIDATEFLAGS:
-            break;
-          case IR::OP_FENCE: {
+          IROP_CASE(DUMMY):
+          IROP_CASE(BEGINBLOCK):
+          IROP_CASE(ENDBLOCK):
+          IROP_CASE(INVALIDATEFLAGS):
+            NEXT();
+          IROP_CASE(FENCE): {
             auto Op = IROp->C<IR::IROp_Fence>();
             switch (Op->Fence) {
               case IR::Fence_Load.Val:
@@ -523,42 +776,30 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               default: LogMan::Msg::A("Unknown Fence: %d", Op->Fence); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_EXITFUNCTION:
-            BlockResults.Quit = true;
-            return;
-            break;
-          case IR::OP_CONDJUMP: {
+          IROP_CASE(EXITFUNCTION):
+            goto ProgramExit;
+          IROP_CASE(CONDJUMP): {
             auto Op = IROp->C<IR::IROp_CondJump>();
             bool CompResult;
 
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Cmp1);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Cmp2);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             if (Op->CompareSize == 4)
               CompResult = IsConditionTrue<uint32_t, int32_t, float>(Op->Cond.Val, Src1, Src2);
             else
               CompResult = IsConditionTrue<uint64_t, int64_t, double>(Op->Cond.Val, Src1, Src2);
 
-            if (CompResult) {
-              BlockIterator = NodeIterator(ListBegin, DataBegin, Op->TrueBlock);
-            }
-            else  {
-              BlockIterator = NodeIterator(ListBegin, DataBegin, Op->FalseBlock);
-            }
-            BlockResults.Redo = true;
-            return;
-            break;
+            PC = &Program->Ops[CurrentOp->Target[CompResult ? 0 : 1]];
+            NEXT();
           }
-          case IR::OP_JUMP: {
-            auto Op = IROp->C<IR::IROp_Jump>();
-            BlockIterator = NodeIterator(ListBegin, DataBegin, Op->Header.Args[0]);
-            BlockResults.Redo = true;
-            return;
-            break;
+          IROP_CASE(JUMP): {
+            PC = &Program->Ops[CurrentOp->Target[0]];
+            NEXT();
           }
-          case IR::OP_BREAK: {
+          IROP_CASE(BREAK): {
             auto Op = IROp->C<IR::IROp_Break>();
             switch (Op->Reason) {
               case 4: // HLT
@@ -566,56 +807,99 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               break;
             default: LogMan::Msg::A("Unknown Break Reason: %d", Op->Reason); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_SIGNALRETURN: {
+          IROP_CASE(SIGNALRETURN): {
             SignalReturn(State);
-            break;
+            NEXT();
           }
-          case IR::OP_CALLBACKRETURN: {
+          IROP_CASE(CALLBACKRETURN): {
             ReturnPtr(State, stack);
-            break;
+            NEXT();
           }
-          case IR::OP_SYSCALL: {
+          IROP_CASE(SYSCALL): {
             auto Op = IROp->C<IR::IROp_Syscall>();
 
             FEXCore::HLE::SyscallArguments Args;
             for (size_t j = 0; j < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++j) {
               if (Op->Header.Args[j].IsInvalid()) break;
-              Args.Argument[j] = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[j]);
+              Args.Argument[j] = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[j]);
             }
 
             uint64_t Res = FEXCore::Context::HandleSyscall(CTX->SyscallHandler, Thread, &Args);
             GD = Res;
-            break;
+            NEXT();
+          }
+          IROP_CASE(DIRECTSYSCALL): {
+            auto Op = IROp->C<IR::IROp_DirectSyscall>();
+
+            uint64_t Args[6]{};
+            for (size_t j = 0; j < Op->NumArgs; ++j) {
+              Args[j] = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[j]);
+            }
+
+            using Arg0 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread);
+            using Arg1 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t);
+            using Arg2 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t);
+            using Arg3 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t);
+            using Arg4 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t, uint64_t);
+            using Arg5 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+            using Arg6 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+
+            switch (Op->NumArgs) {
+              case 0: GD = reinterpret_cast<Arg0>(Op->HandlerFnPtr)(Thread); break;
+              case 1: GD = reinterpret_cast<Arg1>(Op->HandlerFnPtr)(Thread, Args[0]); break;
+              case 2: GD = reinterpret_cast<Arg2>(Op->HandlerFnPtr)(Thread, Args[0], Args[1]); break;
+              case 3: GD = reinterpret_cast<Arg3>(Op->HandlerFnPtr)(Thread, Args[0], Args[1], Args[2]); break;
+              case 4: GD = reinterpret_cast<Arg4>(Op->HandlerFnPtr)(Thread, Args[0], Args[1], Args[2], Args[3]); break;
+              case 5: GD = reinterpret_cast<Arg5>(Op->HandlerFnPtr)(Thread, Args[0], Args[1], Args[2], Args[3], Args[4]); break;
+              case 6: GD = reinterpret_cast<Arg6>(Op->HandlerFnPtr)(Thread, Args[0], Args[1], Args[2], Args[3], Args[4], Args[5]); break;
+              default: LogMan::Msg::A("Unhandled DirectSyscall argument count: %d", Op->NumArgs); break;
+            }
+            NEXT();
+          }
+          IROP_CASE(INLINESYSCALL): {
+            auto Op = IROp->C<IR::IROp_InlineSyscall>();
+
+            uint64_t Args[6]{};
+            for (size_t j = 0; j < Op->NumArgs; ++j) {
+              Args[j] = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[j]);
+            }
+
+            uint64_t Res = ::syscall(Op->HostSyscallNumber, Args[0], Args[1], Args[2], Args[3], Args[4], Args[5]);
+            if (Res == -1) {
+              Res = -errno;
+            }
+            GD = Res;
+            NEXT();
           }
-          case IR::OP_THUNK: {
+          IROP_CASE(THUNK): {
             auto Op = IROp->C<IR::IROp_Thunk>();
 
             //LogMan::Msg::D("Thunk function: %s, %p, %p\n", Op->ThunkName, Op->ThunkFnPtr, *GetSrc<void**>(Op->Header.Args[0]));
 
-            reinterpret_cast<ThunkedFunction*>(Op->ThunkFnPtr)(*GetSrc<void**>(SSAData, Op->Header.Args[0]));
+            reinterpret_cast<ThunkedFunction*>(Op->ThunkFnPtr)(*GetSrc<void**>(SSAData, CurrentOp->Args[0]));
 
-            break;
+            NEXT();
           }
-          case IR::OP_CPUID: {
+          IROP_CASE(CPUID): {
             auto Op = IROp->C<IR::IROp_CPUID>();
             uint64_t *DstPtr = GetDest<uint64_t*>(SSAData, WrapperOp);
-            uint64_t Arg = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t Arg = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
 
             auto Results = CTX->CPUID.RunFunction(Arg);
             memcpy(DstPtr, &Results, sizeof(uint32_t) * 4);
-            break;
+            NEXT();
           }
-          case IR::OP_PRINT: {
+          IROP_CASE(PRINT): {
             auto Op = IROp->C<IR::IROp_Print>();
 
             if (OpSize <= 8) {
-              uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+              uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
               LogMan::Msg::I(">>>> Value in Arg: 0x%lx, %ld", Src, Src);
             }
             else if (OpSize == 16) {
-              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
               uint64_t Src0 = Src;
               uint64_t Src1 = Src >> 64;
               LogMan::Msg::I(">>>> Value[0] in Arg: 0x%lx, %ld", Src0, Src0);
@@ -623,9 +907,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
             else
               LogMan::Msg::A("Unknown value size: %d", OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_CYCLECOUNTER: {
+          IROP_CASE(CYCLECOUNTER): {
             #ifdef DEBUG_CYCLES
               GD = 0;
             #else
@@ -633,24 +917,24 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               clock_gettime(CLOCK_REALTIME, &time);
               GD = time.tv_nsec + time.tv_sec * 1000000000;
             #endif
-            break;
+            NEXT();
           }
-          case IR::OP_MOV: {
+          IROP_CASE(MOV): {
             auto Op = IROp->C<IR::IROp_Mov>();
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), OpSize);
-            break;
+            memcpy(GDP, GetSrc<void*>(SSAData, CurrentOp->Args[0]), OpSize);
+            NEXT();
           }
-          case IR::OP_VBITCAST: {
+          IROP_CASE(VBITCAST): {
             auto Op = IROp->C<IR::IROp_VBitcast>();
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), 16);
-            break;
+            memcpy(GDP, GetSrc<void*>(SSAData, CurrentOp->Args[0]), 16);
+            NEXT();
           }
-          case IR::OP_VCASTFROMGPR: {
+          IROP_CASE(VCASTFROMGPR): {
             auto Op = IROp->C<IR::IROp_VCastFromGPR>();
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), Op->Header.ElementSize);
-            break;
+            memcpy(GDP, GetSrc<void*>(SSAData, CurrentOp->Args[0]), Op->Header.ElementSize);
+            NEXT();
           }
-          case IR::OP_VEXTRACTTOGPR: {
+          IROP_CASE(VEXTRACTTOGPR): {
             auto Op = IROp->C<IR::IROp_VExtractToGPR>();
             uint32_t SourceSize = GetOpSize(Op->Header.Args[0]);
 
@@ -662,7 +946,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               if (Op->Header.ElementSize == 8)
                 SourceMask = ~0ULL;
 
-              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
               Src >>= Shift;
               Src &= SourceMask;
               memcpy(GDP, &Src, Op->Header.ElementSize);
@@ -673,14 +957,14 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               if (Op->Header.ElementSize == 8)
                 SourceMask = ~0ULL;
 
-              uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+              uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
               Src >>= Shift;
               Src &= SourceMask;
               GD = Src;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_VEXTRACTELEMENT: {
+          IROP_CASE(VEXTRACTELEMENT): {
             auto Op = IROp->C<IR::IROp_VExtractElement>();
             uint32_t SourceSize = GetOpSize(Op->Header.Args[0]);
             LogMan::Throw::A(OpSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
@@ -690,7 +974,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               if (Op->Header.ElementSize == 8)
                 SourceMask = ~0ULL;
 
-              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
               Src >>= Shift;
               Src &= SourceMask;
               memcpy(GDP, &Src, Op->Header.ElementSize);
@@ -701,23 +985,23 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               if (Op->Header.ElementSize == 8)
                 SourceMask = ~0ULL;
 
-              uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+              uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
               Src >>= Shift;
               Src &= SourceMask;
               GD = Src;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_CONSTANT: {
+          IROP_CASE(CONSTANT): {
             auto Op = IROp->C<IR::IROp_Constant>();
             GD = Op->Constant;
-            break;
+            NEXT();
           }
-          case IR::OP_VECTORZERO: {
+          IROP_CASE(VECTORZERO): {
             memset(GDP, 0, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_LOADCONTEXT: {
+          IROP_CASE(LOADCONTEXT): {
             auto Op = IROp->C<IR::IROp_LoadContext>();
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
@@ -741,11 +1025,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default:  LogMan::Msg::A("Unhandled LoadContext size: %d", OpSize);
             }
             #undef LOAD_CTX
-            break;
+            NEXT();
           }
-          case IR::OP_LOADCONTEXTINDEXED: {
+          IROP_CASE(LOADCONTEXTINDEXED): {
             auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t Index = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
             ContextPtr += Op->BaseOffset;
@@ -770,33 +1054,33 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default:  LogMan::Msg::A("Unhandled LoadContextIndexed size: %d", Op->Size);
             }
             #undef LOAD_CTX
-            break;
+            NEXT();
           }
-          case IR::OP_STORECONTEXT: {
+          IROP_CASE(STORECONTEXT): {
             auto Op = IROp->C<IR::IROp_StoreContext>();
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
             ContextPtr += Op->Offset;
 
             void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             memcpy(Data, Src, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_STORECONTEXTINDEXED: {
+          IROP_CASE(STORECONTEXTINDEXED): {
             auto Op = IROp->C<IR::IROp_StoreContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Index = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
             ContextPtr += Op->BaseOffset;
             ContextPtr += Index * Op->Stride;
 
             void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             memcpy(Data, Src, Op->Size);
-            break;
+            NEXT();
           }
-          case IR::OP_LOADCONTEXTPAIR: {
+          IROP_CASE(LOADCONTEXTPAIR): {
             auto Op = IROp->C<IR::IROp_LoadContextPair>();
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
@@ -804,46 +1088,46 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
 
             void *Data = reinterpret_cast<void*>(ContextPtr);
             memcpy(GDP, Data, Op->Size * 2);
-            break;
+            NEXT();
           }
-          case IR::OP_STORECONTEXTPAIR: {
+          IROP_CASE(STORECONTEXTPAIR): {
             auto Op = IROp->C<IR::IROp_StoreContextPair>();
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
             ContextPtr += Op->Offset;
 
             void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             memcpy(Data, Src, Op->Size * 2);
-            break;
+            NEXT();
           }
-          case IR::OP_CREATEELEMENTPAIR: {
+          IROP_CASE(CREATEELEMENTPAIR): {
             auto Op = IROp->C<IR::IROp_CreateElementPair>();
-            void *Src_Lower = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src_Upper = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src_Lower = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src_Upper = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             memcpy(GDP, Src_Lower, Op->Header.Size);
             memcpy(reinterpret_cast<void*>(reinterpret_cast<uint64_t>(GDP) + Op->Header.Size),
               Src_Upper, Op->Header.Size);
-            break;
+            NEXT();
           }
-          case IR::OP_EXTRACTELEMENTPAIR: {
+          IROP_CASE(EXTRACTELEMENTPAIR): {
             auto Op = IROp->C<IR::IROp_ExtractElementPair>();
-            uintptr_t Src = GetSrc<uintptr_t>(SSAData, Op->Header.Args[0]);
+            uintptr_t Src = GetSrc<uintptr_t>(SSAData, CurrentOp->Args[0]);
             memcpy(GDP,
               reinterpret_cast<void*>(Src + Op->Header.Size * Op->Element), Op->Header.Size);
-            break;
+            NEXT();
           }
-          case IR::OP_CASPAIR: {
+          IROP_CASE(CASPAIR): {
             auto Op = IROp->C<IR::IROp_CASPair>();
             auto Size = OpSize;
             // Size is the size of each pair element
             switch (Size) {
               case 4: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[2]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[2]);
 
-                uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
                 uint64_t Expected = Src1;
                 bool Result = Data->compare_exchange_strong(Expected, Src2);
@@ -851,10 +1135,10 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                std::atomic<__uint128_t> *Data = *GetSrc<std::atomic<__uint128_t> **>(SSAData, Op->Header.Args[2]);
+                std::atomic<__uint128_t> *Data = *GetSrc<std::atomic<__uint128_t> **>(SSAData, CurrentOp->Args[2]);
 
-                __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-                __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+                __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+                __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
                 __uint128_t Expected = Src1;
                 bool Result = Data->compare_exchange_strong(Expected, Src2);
@@ -863,14 +1147,14 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_TRUNCELEMENTPAIR: {
+          IROP_CASE(TRUNCELEMENTPAIR): {
             auto Op = IROp->C<IR::IROp_TruncElementPair>();
 
             switch (Op->Size) {
               case 4: {
-                uint64_t *Src = GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+                uint64_t *Src = GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
                 uint64_t Result{};
                 Result = Src[0] & ~0U;
                 Result |= Src[1] << 32;
@@ -879,9 +1163,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unhandled Truncation size: %d", Op->Size); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_LOADFLAG: {
+          IROP_CASE(LOADFLAG): {
             auto Op = IROp->C<IR::IROp_LoadFlag>();
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
@@ -889,26 +1173,26 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             ContextPtr += Op->Flag;
             uint8_t const *Data = reinterpret_cast<uint8_t const*>(ContextPtr);
             GD = *Data;
-            break;
+            NEXT();
           }
-          case IR::OP_STOREFLAG: {
+          IROP_CASE(STOREFLAG): {
             auto Op = IROp->C<IR::IROp_StoreFlag>();
-            uint8_t Arg = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+            uint8_t Arg = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
 
             uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
             ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
             ContextPtr += Op->Flag;
             uint8_t *Data = reinterpret_cast<uint8_t*>(ContextPtr);
             *Data = Arg;
-            break;
+            NEXT();
           }
-          case IR::OP_LOADMEM:
-          case IR::OP_LOADMEMTSO: {
+          IROP_CASE(LOADMEM):
+          IROP_CASE(LOADMEMTSO): {
             auto Op = IROp->C<IR::IROp_LoadMem>();
-            uint8_t const *Data = *GetSrc<uint8_t const**>(SSAData, Op->Addr);
+            uint8_t const *Data = *GetSrc<uint8_t const**>(SSAData, CurrentOp->Args[0]);
 
             if (!Op->Offset.IsInvalid()) {
-              auto Offset = *GetSrc<uintptr_t const*>(SSAData, Op->Offset) * Op->OffsetScale;
+              auto Offset = *GetSrc<uintptr_t const*>(SSAData, CurrentOp->Args[1]) * Op->OffsetScale;
 
               switch(Op->OffsetType.Val) {
                 case MEM_OFFSET_SXTX.Val: Data +=  Offset; break;
@@ -917,24 +1201,24 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
             }
             memcpy(GDP, Data, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VLOADMEMELEMENT: {
+          IROP_CASE(VLOADMEMELEMENT): {
             auto Op = IROp->C<IR::IROp_VLoadMemElement>();
-            void const *Data = *GetSrc<void const**>(SSAData, Op->Header.Args[0]);
+            void const *Data = *GetSrc<void const**>(SSAData, CurrentOp->Args[0]);
 
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[1]), 16);
+            memcpy(GDP, GetSrc<void*>(SSAData, CurrentOp->Args[1]), 16);
             memcpy(reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(GDP) + (Op->Header.ElementSize * Op->Index)),
               Data, Op->Header.ElementSize);
-            break;
+            NEXT();
           }
-          case IR::OP_STOREMEM:
-          case IR::OP_STOREMEMTSO: {
+          IROP_CASE(STOREMEM):
+          IROP_CASE(STOREMEMTSO): {
             #define STORE_DATA(x, y) \
               case x: { \
-                uint8_t *Data = *GetSrc<uint8_t**>(SSAData, Op->Addr); \
+                uint8_t *Data = *GetSrc<uint8_t**>(SSAData, CurrentOp->Args[0]); \
                 if (!Op->Offset.IsInvalid()) {\
-                  auto Offset = *GetSrc<uintptr_t const*>(SSAData, Op->Offset) * Op->OffsetScale;\
+                  auto Offset = *GetSrc<uintptr_t const*>(SSAData, CurrentOp->Args[2]) * Op->OffsetScale;\
                   \
                   switch(Op->OffsetType.Val) {\
                     case MEM_OFFSET_SXTX.Val: Data +=  Offset; break;\
@@ -942,7 +1226,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                     case MEM_OFFSET_SXTW.Val: Data += (int32_t)Offset; break;\
                   }\
                 }\
-                memcpy((y*)Data, GetSrc<y*>(SSAData, Op->Value), sizeof(y)); \
+                memcpy((y*)Data, GetSrc<y*>(SSAData, CurrentOp->Args[1]), sizeof(y)); \
                 break; \
               }
 
@@ -954,22 +1238,22 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               STORE_DATA(4, uint32_t)
               STORE_DATA(8, uint64_t)
               case 16: {
-                void *Data = *GetSrc<void**>(SSAData, Op->Header.Args[0]);
+                void *Data = *GetSrc<void**>(SSAData, CurrentOp->Args[0]);
 
-                void *Src = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+                void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
                 memcpy(Data, Src, 16);
                 break;
               }
               default: LogMan::Msg::A("Unhandled StoreMem size"); break;
             }
             #undef STORE_DATA
-            break;
+            NEXT();
           }
-          case IR::OP_VSTOREMEMELEMENT: {
+          IROP_CASE(VSTOREMEMELEMENT): {
             #define STORE_DATA(x, y) \
               case x: { \
-                y *Data = *GetSrc<y**>(SSAData, Op->Header.Args[0]); \
-                memcpy(Data, &GetSrc<y*>(SSAData, Op->Header.Args[1])[Op->Index], sizeof(y)); \
+                y *Data = *GetSrc<y**>(SSAData, CurrentOp->Args[0]); \
+                memcpy(Data, &GetSrc<y*>(SSAData, CurrentOp->Args[1])[Op->Index], sizeof(y)); \
                 break; \
               }
 
@@ -983,7 +1267,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unhandled StoreMem size"); break;
             }
             #undef STORE_DATA
-            break;
+            NEXT();
           }
           #define DO_OP(size, type, func)              \
             case size: {                                      \
@@ -994,10 +1278,10 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             break;                                            \
             }
 
-          case IR::OP_ADD: {
+          IROP_CASE(ADD): {
             auto Op = IROp->C<IR::IROp_Add>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             auto Func = [](auto a, auto b) { return a + b; };
 
             switch (OpSize) {
@@ -1005,12 +1289,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               DO_OP(8, uint64_t, Func)
               default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_SUB: {
+          IROP_CASE(SUB): {
             auto Op = IROp->C<IR::IROp_Sub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             auto Func = [](auto a, auto b) { return a - b; };
 
             switch (OpSize) {
@@ -1018,11 +1302,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               DO_OP(8, uint64_t, Func)
               default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_NEG: {
+          IROP_CASE(NEG): {
             auto Op = IROp->C<IR::IROp_Neg>();
-            uint64_t Src = *GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t Src = *GetSrc<int64_t*>(SSAData, CurrentOp->Args[0]);
             switch (OpSize) {
               case 4:
                 GD = -static_cast<int32_t>(Src);
@@ -1032,12 +1316,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               default: LogMan::Msg::A("Unknown NEG Size: %d\n", OpSize); break;
             };
-            break;
+            NEXT();
           }
-          case IR::OP_OR: {
+          IROP_CASE(OR): {
             auto Op = IROp->C<IR::IROp_Or>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             auto Func = [](auto a, auto b) { return a | b; };
 
             switch (OpSize) {
@@ -1048,12 +1332,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               DO_OP(16, __uint128_t, Func)
               default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_AND: {
+          IROP_CASE(AND): {
             auto Op = IROp->C<IR::IROp_And>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             auto Func = [](auto a, auto b) { return a & b; };
 
             switch (OpSize) {
@@ -1063,12 +1347,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               DO_OP(8, uint64_t, Func)
               default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_XOR: {
+          IROP_CASE(XOR): {
             auto Op = IROp->C<IR::IROp_Xor>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             auto Func = [](auto a, auto b) { return a ^ b; };
 
             switch (OpSize) {
@@ -1078,12 +1362,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               DO_OP(8, uint64_t, Func)
               default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_LSHL: {
+          IROP_CASE(LSHL): {
             auto Op = IROp->C<IR::IROp_Lshl>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
             uint8_t Mask = OpSize * 8 - 1;
             switch (OpSize) {
               case 4:
@@ -1094,20 +1378,20 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               default: LogMan::Msg::A("Unknown LSHL Size: %d\n", OpSize); break;
             };
-            break;
+            NEXT();
           }
-          case IR::OP_LSHR: {
+          IROP_CASE(LSHR): {
             auto Op = IROp->C<IR::IROp_Lshr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
             uint8_t Mask = OpSize * 8 - 1;
             GD = Src1 >> (Src2 & Mask);
-            break;
+            NEXT();
           }
-          case IR::OP_ASHR: {
+          IROP_CASE(ASHR): {
             auto Op = IROp->C<IR::IROp_Ashr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
             uint8_t Mask = OpSize * 8 - 1;
             switch (OpSize) {
               case 1:
@@ -1124,12 +1408,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
             };
-            break;
+            NEXT();
           }
-          case IR::OP_ROR: {
+          IROP_CASE(ROR): {
             auto Op = IROp->C<IR::IROp_Ror>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
             auto Ror = [] (auto In, auto R) {
             auto RotateMask = sizeof(In) * 8 - 1;
               R &= RotateMask;
@@ -1146,12 +1430,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown ROR Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_EXTR: {
+          IROP_CASE(EXTR): {
             auto Op = IROp->C<IR::IROp_Extr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
             auto Extr = [] (auto Src1, auto Src2, uint8_t lsb) -> decltype(Src1) {
               __uint128_t Result{};
               Result = Src1;
@@ -1171,20 +1455,20 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown EXTR Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_NOT: {
+          IROP_CASE(NOT): {
             auto Op = IROp->C<IR::IROp_Not>();
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
             const uint64_t mask[9]= { 0, 0xFF, 0xFFFF, 0, 0xFFFFFFFF, 0, 0, 0, 0xFFFFFFFFFFFFFFFFULL };
             uint64_t Mask = mask[OpSize];
             GD = (~Src) & Mask;
-            break;
+            NEXT();
           }
-          case IR::OP_MUL: {
+          IROP_CASE(MUL): {
             auto Op = IROp->C<IR::IROp_Mul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             switch (OpSize) {
               case 4:
@@ -1200,12 +1484,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_MULH: {
+          IROP_CASE(MULH): {
             auto Op = IROp->C<IR::IROp_MulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             switch (OpSize) {
               case 4: {
@@ -1220,12 +1504,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               break;
               default: LogMan::Msg::A("Unknown MulH Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_UMUL: {
+          IROP_CASE(UMUL): {
             auto Op = IROp->C<IR::IROp_UMul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             switch (OpSize) {
               case 4:
@@ -1241,12 +1525,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown UMul Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_UMULH: {
+          IROP_CASE(UMULH): {
             auto Op = IROp->C<IR::IROp_UMulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
             switch (OpSize) {
               case 4:
                 GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
@@ -1265,12 +1549,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown UMulH Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_DIV: {
+          IROP_CASE(DIV): {
             auto Op = IROp->C<IR::IROp_Div>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             switch (OpSize) {
               case 1:
@@ -1286,18 +1570,18 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 GD = static_cast<int64_t>(Src1) / static_cast<int64_t>(Src2);
                 break;
               case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, Op->Header.Args[0]) / *GetSrc<__int128_t*>(SSAData, Op->Header.Args[1]);
+                __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, CurrentOp->Args[0]) / *GetSrc<__int128_t*>(SSAData, CurrentOp->Args[1]);
                 memcpy(GDP, &Tmp, 16);
                 break;
               }
               default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_UDIV: {
+          IROP_CASE(UDIV): {
             auto Op = IROp->C<IR::IROp_UDiv>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             switch (OpSize) {
               case 1:
@@ -1313,18 +1597,18 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 GD = static_cast<uint64_t>(Src1) / static_cast<uint64_t>(Src2);
                 break;
               case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]) / *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+                __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]) / *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
                 memcpy(GDP, &Tmp, 16);
                 break;
               }
               default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_REM: {
+          IROP_CASE(REM): {
             auto Op = IROp->C<IR::IROp_Rem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             switch (OpSize) {
               case 1:
@@ -1340,18 +1624,18 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 GD = static_cast<int64_t>(Src1) % static_cast<int64_t>(Src2);
                 break;
               case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, Op->Header.Args[0]) % *GetSrc<__int128_t*>(SSAData, Op->Header.Args[1]);
+                __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, CurrentOp->Args[0]) % *GetSrc<__int128_t*>(SSAData, CurrentOp->Args[1]);
                 memcpy(GDP, &Tmp, 16);
                 break;
               }
               default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_UREM: {
+          IROP_CASE(UREM): {
             auto Op = IROp->C<IR::IROp_URem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             switch (OpSize) {
               case 1:
@@ -1367,53 +1651,53 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 GD = static_cast<uint64_t>(Src1) % static_cast<uint64_t>(Src2);
                 break;
               case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]) % *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+                __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]) % *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
                 memcpy(GDP, &Tmp, 16);
                 break;
               }
               default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_POPCOUNT: {
+          IROP_CASE(POPCOUNT): {
             auto Op = IROp->C<IR::IROp_Popcount>();
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
             GD = __builtin_popcountl(Src);
-            break;
+            NEXT();
           }
-          case IR::OP_FINDLSB: {
+          IROP_CASE(FINDLSB): {
             auto Op = IROp->C<IR::IROp_FindLSB>();
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
             uint64_t Result = __builtin_ffsll(Src);
             GD = Result - 1;
-            break;
+            NEXT();
           }
-          case IR::OP_FINDMSB: {
+          IROP_CASE(FINDMSB): {
             auto Op = IROp->C<IR::IROp_FindMSB>();
             switch (OpSize) {
-              case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
-              case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
-              case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
-              case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
+              case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]))) - 1; break;
+              case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]))) - 1; break;
+              case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]))) - 1; break;
+              case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]))) - 1; break;
               default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_REV: {
+          IROP_CASE(REV): {
             auto Op = IROp->C<IR::IROp_Rev>();
             switch (OpSize) {
-              case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(SSAData, Op->Header.Args[0])); break;
-              case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0])); break;
-              case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0])); break;
+              case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0])); break;
+              case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0])); break;
+              case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0])); break;
               default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_FINDTRAILINGZEROS: {
+          IROP_CASE(FINDTRAILINGZEROS): {
             auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
             switch (OpSize) {
               case 1: {
-                auto Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+                auto Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
                 if (Src)
                   GD = __builtin_ctz(Src);
                 else
@@ -1421,7 +1705,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 2: {
-                auto Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+                auto Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
                 if (Src)
                   GD = __builtin_ctz(Src);
                 else
@@ -1429,7 +1713,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 4: {
-                auto Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+                auto Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
                 if (Src)
                   GD = __builtin_ctz(Src);
                 else
@@ -1437,7 +1721,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                auto Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+                auto Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
                 if (Src)
                   GD = __builtin_ctzll(Src);
                 else
@@ -1446,13 +1730,13 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_COUNTLEADINGZEROES: {
+          IROP_CASE(COUNTLEADINGZEROES): {
             auto Op = IROp->C<IR::IROp_CountLeadingZeroes>();
             switch (OpSize) {
               case 1: {
-                uint32_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+                uint32_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
                 Src <<= 24;
                 if (Src)
                   GD = __builtin_clz(Src);
@@ -1461,7 +1745,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 2: {
-                uint32_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+                uint32_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
                 Src <<= 16;
                 if (Src)
                   GD = __builtin_clz(Src);
@@ -1470,7 +1754,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 4: {
-                auto Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+                auto Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
                 if (Src)
                   GD = __builtin_clz(Src);
                 else
@@ -1478,7 +1762,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                auto Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+                auto Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
                 if (Src)
                   GD = __builtin_clzll(Src);
                 else
@@ -1487,57 +1771,57 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_BFI: {
+          IROP_CASE(BFI): {
             auto Op = IROp->C<IR::IROp_Bfi>();
             uint64_t SourceMask = (1ULL << Op->Width) - 1;
             if (Op->Width == 64)
               SourceMask = ~0ULL;
             uint64_t DestMask = ~(SourceMask << Op->lsb);
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
             uint64_t Res = (Src1 & DestMask) | ((Src2 & SourceMask) << Op->lsb);
             GD = Res;
-            break;
+            NEXT();
           }
-          case IR::OP_SBFE: {
+          IROP_CASE(SBFE): {
             auto Op = IROp->C<IR::IROp_Sbfe>();
             LogMan::Throw::A(OpSize < 16, "OpSize is too large for BFE: %d", OpSize);
-            int64_t Src = *GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+            int64_t Src = *GetSrc<int64_t*>(SSAData, CurrentOp->Args[0]);
             uint64_t ShiftLeftAmount = (64 - (Op->Width + Op->lsb));
             uint64_t ShiftRightAmount = ShiftLeftAmount + Op->lsb;
             Src <<= ShiftLeftAmount;
             Src >>= ShiftRightAmount;
             GD = Src;
-            break;
+            NEXT();
           }
-          case IR::OP_BFE: {
+          IROP_CASE(BFE): {
             auto Op = IROp->C<IR::IROp_Bfe>();
             LogMan::Throw::A(OpSize <= 8, "OpSize is too large for BFE: %d", OpSize);
             uint64_t SourceMask = (1ULL << Op->Width) - 1;
             if (Op->Width == 64)
               SourceMask = ~0ULL;
             SourceMask <<= Op->lsb;
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
             GD = (Src & SourceMask) >> Op->lsb;
-            break;
+            NEXT();
           }
-          case IR::OP_SELECT: {
+          IROP_CASE(SELECT): {
             auto Op = IROp->C<IR::IROp_Select>();
 
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
             uint64_t ArgTrue;
             uint64_t ArgFalse;
 
             if (OpSize == 4) {
-              ArgTrue = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
-              ArgFalse = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[3]);
+              ArgTrue = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[2]);
+              ArgFalse = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[3]);
             } else {
-              ArgTrue = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
-              ArgFalse = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[3]);
+              ArgTrue = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[2]);
+              ArgFalse = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[3]);
             }
 
             bool CompResult;
@@ -1548,17 +1832,17 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               CompResult = IsConditionTrue<uint64_t, int64_t, double>(Op->Cond.Val, Src1, Src2);
 
             GD = CompResult ? ArgTrue : ArgFalse;
-            break;
+            NEXT();
           }
-          case IR::OP_CAS: {
+          IROP_CASE(CAS): {
             auto Op = IROp->C<IR::IROp_CAS>();
             auto Size = OpSize;
             switch (Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[2]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[2]);
 
-                uint8_t Src1 = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-                uint8_t Src2 = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                uint8_t Src1 = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src2 = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
 
                 uint8_t Expected = Src1;
                 bool Result = Data->compare_exchange_strong(Expected, Src2);
@@ -1566,9 +1850,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[2]);
-                uint16_t Src1 = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t Src2 = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[2]);
+                uint16_t Src1 = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src2 = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
 
                 uint16_t Expected = Src1;
                 bool Result = Data->compare_exchange_strong(Expected, Src2);
@@ -1576,10 +1860,10 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[2]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[2]);
 
-                uint32_t Src1 = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t Src2 = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                uint32_t Src1 = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src2 = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
 
                 uint32_t Expected = Src1;
                 bool Result = Data->compare_exchange_strong(Expected, Src2);
@@ -1587,10 +1871,10 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[2]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[2]);
 
-                uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
 
                 uint64_t Expected = Src1;
                 bool Result = Data->compare_exchange_strong(Expected, Src2);
@@ -1599,379 +1883,379 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICADD: {
+          IROP_CASE(ATOMICADD): {
             auto Op = IROp->C<IR::IROp_AtomicAdd>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 *Data += Src;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 *Data += Src;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 *Data += Src;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 *Data += Src;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICSUB: {
+          IROP_CASE(ATOMICSUB): {
             auto Op = IROp->C<IR::IROp_AtomicSub>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 *Data -= Src;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 *Data -= Src;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 *Data -= Src;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 *Data -= Src;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICAND: {
+          IROP_CASE(ATOMICAND): {
             auto Op = IROp->C<IR::IROp_AtomicAnd>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 *Data &= Src;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 *Data &= Src;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 *Data &= Src;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 *Data &= Src;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICOR: {
+          IROP_CASE(ATOMICOR): {
             auto Op = IROp->C<IR::IROp_AtomicOr>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 *Data |= Src;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 *Data |= Src;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 *Data |= Src;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 *Data |= Src;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICXOR: {
+          IROP_CASE(ATOMICXOR): {
             auto Op = IROp->C<IR::IROp_AtomicXor>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 *Data ^= Src;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 *Data ^= Src;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 *Data ^= Src;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 *Data ^= Src;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICSWAP: {
+          IROP_CASE(ATOMICSWAP): {
             auto Op = IROp->C<IR::IROp_AtomicSwap>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 uint8_t Previous = Data->exchange(Src);
                 GD = Previous;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 uint16_t Previous = Data->exchange(Src);
                 GD = Previous;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 uint32_t Previous = Data->exchange(Src);
                 GD = Previous;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 uint64_t Previous = Data->exchange(Src);
                 GD = Previous;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICFETCHADD: {
+          IROP_CASE(ATOMICFETCHADD): {
             auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 uint8_t Previous = Data->fetch_add(Src);
                 GD = Previous;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 uint16_t Previous = Data->fetch_add(Src);
                 GD = Previous;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 uint32_t Previous = Data->fetch_add(Src);
                 GD = Previous;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 uint64_t Previous = Data->fetch_add(Src);
                 GD = Previous;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICFETCHSUB: {
+          IROP_CASE(ATOMICFETCHSUB): {
             auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 uint8_t Previous = Data->fetch_sub(Src);
                 GD = Previous;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 uint16_t Previous = Data->fetch_sub(Src);
                 GD = Previous;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 uint32_t Previous = Data->fetch_sub(Src);
                 GD = Previous;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 uint64_t Previous = Data->fetch_sub(Src);
                 GD = Previous;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICFETCHAND: {
+          IROP_CASE(ATOMICFETCHAND): {
             auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 uint8_t Previous = Data->fetch_and(Src);
                 GD = Previous;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 uint16_t Previous = Data->fetch_and(Src);
                 GD = Previous;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 uint32_t Previous = Data->fetch_and(Src);
                 GD = Previous;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 uint64_t Previous = Data->fetch_and(Src);
                 GD = Previous;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICFETCHOR: {
+          IROP_CASE(ATOMICFETCHOR): {
             auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 uint8_t Previous = Data->fetch_or(Src);
                 GD = Previous;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 uint16_t Previous = Data->fetch_or(Src);
                 GD = Previous;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 uint32_t Previous = Data->fetch_or(Src);
                 GD = Previous;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 uint64_t Previous = Data->fetch_or(Src);
                 GD = Previous;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_ATOMICFETCHXOR: {
+          IROP_CASE(ATOMICFETCHXOR): {
             auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
             switch (Op->Size) {
               case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, CurrentOp->Args[0]);
+                uint8_t Src = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
                 uint8_t Previous = Data->fetch_xor(Src);
                 GD = Previous;
                 break;
               }
               case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, CurrentOp->Args[0]);
+                uint16_t Src = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
                 uint16_t Previous = Data->fetch_xor(Src);
                 GD = Previous;
                 break;
               }
               case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, CurrentOp->Args[0]);
+                uint32_t Src = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
                 uint32_t Previous = Data->fetch_xor(Src);
                 GD = Previous;
                 break;
               }
               case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, CurrentOp->Args[0]);
+                uint64_t Src = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
                 uint64_t Previous = Data->fetch_xor(Src);
                 GD = Previous;
                 break;
               }
               default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
             }
-            break;
+            NEXT();
           }
           // Vector ops
-          case IR::OP_CREATEVECTOR2: {
+          IROP_CASE(CREATEVECTOR2): {
             auto Op = IROp->C<IR::IROp_CreateVector2>();
             LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
             uint8_t ElementSize = OpSize / 2;
             #define CREATE_VECTOR(elementsize, type) \
@@ -1993,13 +2277,13 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             #undef CREATE_VECTOR
             memcpy(GDP, Tmp, OpSize);
 
-            break;
+            NEXT();
           }
-          case IR::OP_SPLATVECTOR4:
-          case IR::OP_SPLATVECTOR2: {
+          IROP_CASE(SPLATVECTOR4):
+          IROP_CASE(SPLATVECTOR2): {
             auto Op = IROp->C<IR::IROp_SplatVector2>();
             LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
             uint8_t Elements = 0;
 
@@ -2028,67 +2312,67 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             #undef CREATE_VECTOR
             memcpy(GDP, Tmp, OpSize);
 
-            break;
+            NEXT();
           }
-          case IR::OP_VMOV: {
+          IROP_CASE(VMOV): {
             auto Op = IROp->C<IR::IROp_VMov>();
-            __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+            __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
 
             memcpy(GDP, &Src, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VOR: {
+          IROP_CASE(VOR): {
             auto Op = IROp->C<IR::IROp_VOr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             __uint128_t Dst = Src1 | Src2;
             memcpy(GDP, &Dst, 16);
-            break;
+            NEXT();
           }
-          case IR::OP_VAND: {
+          IROP_CASE(VAND): {
             auto Op = IROp->C<IR::IROp_VAnd>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             __uint128_t Dst = Src1 & Src2;
             memcpy(GDP, &Dst, 16);
-            break;
+            NEXT();
           }
-          case IR::OP_VXOR: {
+          IROP_CASE(VXOR): {
             auto Op = IROp->C<IR::IROp_VXor>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             __uint128_t Dst = Src1 ^ Src2;
             memcpy(GDP, &Dst, 16);
-            break;
+            NEXT();
           }
-          case IR::OP_VSLI: {
+          IROP_CASE(VSLI): {
             auto Op = IROp->C<IR::IROp_VSLI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
             __uint128_t Src2 = Op->ByteShift * 8;
 
             __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 << Src2;
             memcpy(GDP, &Dst, 16);
-            break;
+            NEXT();
           }
-          case IR::OP_VSRI: {
+          IROP_CASE(VSRI): {
             auto Op = IROp->C<IR::IROp_VSRI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
             __uint128_t Src2 = Op->ByteShift * 8;
 
             __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 >> Src2;
             memcpy(GDP, &Dst, 16);
-            break;
+            NEXT();
           }
-          case IR::OP_VNOT: {
+          IROP_CASE(VNOT): {
             auto Op = IROp->C<IR::IROp_VNot>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
 
             __uint128_t Dst = ~Src1;
             memcpy(GDP, &Dst, 16);
-            break;
+            NEXT();
           }
           #define DO_VECTOR_OP(size, type, func)              \
             case size: {                                      \
@@ -2159,7 +2443,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }                                                 \
             break;                                            \
             }
-          case IR::OP_VECTORIMM: {
+          IROP_CASE(VECTORIMM): {
             auto Op = IROp->C<IR::IROp_VectorImm>();
             uint8_t Tmp[16];
 
@@ -2175,11 +2459,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VNEG: {
+          IROP_CASE(VNEG): {
             auto Op = IROp->C<IR::IROp_VNeg>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2193,11 +2477,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFNEG: {
+          IROP_CASE(VFNEG): {
             auto Op = IROp->C<IR::IROp_VFNeg>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2209,11 +2493,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUSHRI: {
+          IROP_CASE(VUSHRI): {
             auto Op = IROp->C<IR::IROp_VUShrI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t BitShift = Op->BitShift;
             uint8_t Tmp[16];
 
@@ -2228,11 +2512,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSSHRI: {
+          IROP_CASE(VSSHRI): {
             auto Op = IROp->C<IR::IROp_VSShrI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t BitShift = Op->BitShift;
             uint8_t Tmp[16];
 
@@ -2247,11 +2531,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSHLI: {
+          IROP_CASE(VSHLI): {
             auto Op = IROp->C<IR::IROp_VShlI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t BitShift = Op->BitShift;
             uint8_t Tmp[16];
 
@@ -2266,13 +2550,13 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
 
-          case IR::OP_VADD: {
+          IROP_CASE(VADD): {
             auto Op = IROp->C<IR::IROp_VAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2286,12 +2570,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSUB: {
+          IROP_CASE(VSUB): {
             auto Op = IROp->C<IR::IROp_VSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2305,12 +2589,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUQADD: {
+          IROP_CASE(VUQADD): {
             auto Op = IROp->C<IR::IROp_VUQAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2327,12 +2611,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUQSUB: {
+          IROP_CASE(VUQSUB): {
             auto Op = IROp->C<IR::IROp_VUQSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2349,12 +2633,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSQADD: {
+          IROP_CASE(VSQADD): {
             auto Op = IROp->C<IR::IROp_VSQAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2381,12 +2665,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSQSUB: {
+          IROP_CASE(VSQSUB): {
             auto Op = IROp->C<IR::IROp_VSQSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2409,13 +2693,13 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
 
-          case IR::OP_VFADD: {
+          IROP_CASE(VFADD): {
             auto Op = IROp->C<IR::IROp_VFAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2427,12 +2711,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFADDP: {
+          IROP_CASE(VFADDP): {
             auto Op = IROp->C<IR::IROp_VFAddP>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = (OpSize / Op->Header.ElementSize) / 2;
@@ -2444,12 +2728,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFSUB: {
+          IROP_CASE(VFSUB): {
             auto Op = IROp->C<IR::IROp_VFSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2461,12 +2745,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VADDP: {
+          IROP_CASE(VADDP): {
             auto Op = IROp->C<IR::IROp_VAddP>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = (OpSize / Op->Header.ElementSize) / 2;
@@ -2480,11 +2764,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VADDV: {
+          IROP_CASE(VADDV): {
             auto Op = IROp->C<IR::IROp_VAddV>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2498,12 +2782,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, Op->Header.ElementSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VURAVG: {
+          IROP_CASE(VURAVG): {
             auto Op = IROp->C<IR::IROp_VURAvg>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2515,11 +2799,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VABS: {
+          IROP_CASE(VABS): {
             auto Op = IROp->C<IR::IROp_VAbs>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2533,12 +2817,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFMUL: {
+          IROP_CASE(VFMUL): {
             auto Op = IROp->C<IR::IROp_VFMul>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2550,12 +2834,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFDIV: {
+          IROP_CASE(VFDIV): {
             auto Op = IROp->C<IR::IROp_VFDiv>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2567,12 +2851,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFMIN: {
+          IROP_CASE(VFMIN): {
             auto Op = IROp->C<IR::IROp_VFMin>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2584,12 +2868,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFMAX: {
+          IROP_CASE(VFMAX): {
             auto Op = IROp->C<IR::IROp_VFMax>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2601,11 +2885,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFRECP: {
+          IROP_CASE(VFRECP): {
             auto Op = IROp->C<IR::IROp_VFRecp>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2617,11 +2901,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFSQRT: {
+          IROP_CASE(VFSQRT): {
             auto Op = IROp->C<IR::IROp_VFSqrt>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2633,11 +2917,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFRSQRT: {
+          IROP_CASE(VFRSQRT): {
             auto Op = IROp->C<IR::IROp_VFRSqrt>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2649,7 +2933,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
           #define DO_VECTOR_1SRC_2TYPE_OP(size, type, type2, func, min, max)              \
             case size: {                                      \
@@ -2701,9 +2985,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             break;                                            \
             }
 
-          case IR::OP_VUSHRNI: {
+          IROP_CASE(VUSHRNI): {
             auto Op = IROp->C<IR::IROp_VUShrNI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t BitShift = Op->BitShift;
             uint8_t Tmp[16]{};
 
@@ -2717,12 +3001,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUSHRNI2: {
+          IROP_CASE(VUSHRNI2): {
             auto Op = IROp->C<IR::IROp_VUShrNI2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t BitShift = Op->BitShift;
             uint8_t Tmp[16];
 
@@ -2736,11 +3020,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSQXTN: {
+          IROP_CASE(VSQXTN): {
             auto Op = IROp->C<IR::IROp_VSQXTN>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16]{};
 
             uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
@@ -2752,12 +3036,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSQXTN2: {
+          IROP_CASE(VSQXTN2): {
             auto Op = IROp->C<IR::IROp_VSQXTN2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16]{};
 
             uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
@@ -2769,11 +3053,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSQXTUN: {
+          IROP_CASE(VSQXTUN): {
             auto Op = IROp->C<IR::IROp_VSQXTUN>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16]{};
 
             uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
@@ -2785,12 +3069,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSQXTUN2: {
+          IROP_CASE(VSQXTUN2): {
             auto Op = IROp->C<IR::IROp_VSQXTUN2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16]{};
 
             uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
@@ -2802,11 +3086,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VECTOR_UTOF: {
+          IROP_CASE(VECTOR_UTOF): {
             auto Op = IROp->C<IR::IROp_Vector_UToF>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2818,11 +3102,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VECTOR_STOF: {
+          IROP_CASE(VECTOR_STOF): {
             auto Op = IROp->C<IR::IROp_Vector_SToF>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2834,11 +3118,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VECTOR_FTOZU: {
+          IROP_CASE(VECTOR_FTOZU): {
             auto Op = IROp->C<IR::IROp_Vector_FToZU>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2850,11 +3134,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VECTOR_FTOZS: {
+          IROP_CASE(VECTOR_FTOZS): {
             auto Op = IROp->C<IR::IROp_Vector_FToZS>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2866,11 +3150,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VECTOR_FTOU: {
+          IROP_CASE(VECTOR_FTOU): {
             auto Op = IROp->C<IR::IROp_Vector_FToU>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2882,11 +3166,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VECTOR_FTOS: {
+          IROP_CASE(VECTOR_FTOS): {
             auto Op = IROp->C<IR::IROp_Vector_FToS>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2898,12 +3182,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUMUL: {
+          IROP_CASE(VUMUL): {
             auto Op = IROp->C<IR::IROp_VUMul>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2917,12 +3201,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSMUL: {
+          IROP_CASE(VSMUL): {
             auto Op = IROp->C<IR::IROp_VSMul>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -2936,12 +3220,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUMULL: {
+          IROP_CASE(VUMULL): {
             auto Op = IROp->C<IR::IROp_VUMull>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             uint8_t Tmp[16];
 
@@ -2955,12 +3239,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSMULL: {
+          IROP_CASE(VSMULL): {
             auto Op = IROp->C<IR::IROp_VSMull>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             uint8_t Tmp[16];
 
@@ -2974,12 +3258,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUMULL2: {
+          IROP_CASE(VUMULL2): {
             auto Op = IROp->C<IR::IROp_VUMull2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             uint8_t Tmp[16];
 
@@ -2993,12 +3277,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSMULL2: {
+          IROP_CASE(VSMULL2): {
             auto Op = IROp->C<IR::IROp_VSMull2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             uint8_t Tmp[16];
 
@@ -3012,11 +3296,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, Op->Header.Size);
-            break;
+            NEXT();
           }
-          case IR::OP_VSXTL: {
+          IROP_CASE(VSXTL): {
             auto Op = IROp->C<IR::IROp_VSXTL>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16]{};
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3029,11 +3313,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSXTL2: {
+          IROP_CASE(VSXTL2): {
             auto Op = IROp->C<IR::IROp_VSXTL2>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3046,11 +3330,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUXTL: {
+          IROP_CASE(VUXTL): {
             auto Op = IROp->C<IR::IROp_VUXTL>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16]{};
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3063,11 +3347,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUXTL2: {
+          IROP_CASE(VUXTL2): {
             auto Op = IROp->C<IR::IROp_VUXTL2>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
 
             uint8_t Tmp[16];
 
@@ -3081,12 +3365,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUMIN: {
+          IROP_CASE(VUMIN): {
             auto Op = IROp->C<IR::IROp_VUMin>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3100,12 +3384,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSMIN: {
+          IROP_CASE(VSMIN): {
             auto Op = IROp->C<IR::IROp_VSMin>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3119,12 +3403,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUMAX: {
+          IROP_CASE(VUMAX): {
             auto Op = IROp->C<IR::IROp_VUMax>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3138,12 +3422,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSMAX: {
+          IROP_CASE(VSMAX): {
             auto Op = IROp->C<IR::IROp_VSMax>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3157,12 +3441,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUSHL: {
+          IROP_CASE(VUSHL): {
             auto Op = IROp->C<IR::IROp_VUShl>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3176,12 +3460,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSSHR: {
+          IROP_CASE(VSSHR): {
             auto Op = IROp->C<IR::IROp_VSShr>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3195,13 +3479,13 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
 
-          case IR::OP_VUSHLS: {
+          IROP_CASE(VUSHLS): {
             auto Op = IROp->C<IR::IROp_VUShlS>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3216,12 +3500,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUSHRS: {
+          IROP_CASE(VUSHRS): {
             auto Op = IROp->C<IR::IROp_VUShrS>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3236,12 +3520,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VSSHRS: {
+          IROP_CASE(VSSHRS): {
             auto Op = IROp->C<IR::IROp_VSShrS>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3256,12 +3540,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VUSHR: {
+          IROP_CASE(VUSHR): {
             auto Op = IROp->C<IR::IROp_VUShr>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3275,13 +3559,13 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VZIP2:
-          case IR::OP_VZIP: {
+          IROP_CASE(VZIP2):
+          IROP_CASE(VZIP): {
             auto Op = IROp->C<IR::IROp_VZip>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
             uint8_t Elements = OpSize / Op->Header.ElementSize;
             uint8_t BaseOffset = IROp->Op == IR::OP_VZIP2 ? (Elements / 2) : 0;
@@ -3332,12 +3616,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VINSELEMENT: {
+          IROP_CASE(VINSELEMENT): {
             auto Op = IROp->C<IR::IROp_VInsElement>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             // Copy src1 in to dest
@@ -3370,12 +3654,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             };
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VINSSCALARELEMENT: {
+          IROP_CASE(VINSSCALARELEMENT): {
             auto Op = IROp->C<IR::IROp_VInsScalarElement>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             // Copy src1 in to dest
@@ -3408,26 +3692,26 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
             };
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
 
-          case IR::OP_VBSL: {
+          IROP_CASE(VBSL): {
             auto Op = IROp->C<IR::IROp_VBSL>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-            __uint128_t Src3 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[2]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
+            __uint128_t Src3 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[2]);
 
             __uint128_t Tmp{};
             Tmp = Src2 & Src1;
             Tmp |= Src3 & ~Src1;
 
             memcpy(GDP, &Tmp, 16);
-            break;
+            NEXT();
           }
-          case IR::OP_VCMPEQ: {
+          IROP_CASE(VCMPEQ): {
             auto Op = IROp->C<IR::IROp_VCMPEQ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3442,11 +3726,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VCMPEQZ: {
+          IROP_CASE(VCMPEQZ): {
             auto Op = IROp->C<IR::IROp_VCMPEQZ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Src2[16]{};
             uint8_t Tmp[16];
 
@@ -3462,12 +3746,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VCMPGT: {
+          IROP_CASE(VCMPGT): {
             auto Op = IROp->C<IR::IROp_VCMPGT>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
             uint8_t Tmp[16];
 
             uint8_t Elements = OpSize / Op->Header.ElementSize;
@@ -3482,11 +3766,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VCMPGTZ: {
+          IROP_CASE(VCMPGTZ): {
             auto Op = IROp->C<IR::IROp_VCMPGTZ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Src2[16]{};
             uint8_t Tmp[16];
 
@@ -3502,11 +3786,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VCMPLTZ: {
+          IROP_CASE(VCMPLTZ): {
             auto Op = IROp->C<IR::IROp_VCMPLTZ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Src2[16]{};
             uint8_t Tmp[16];
 
@@ -3522,17 +3806,17 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_LUDIV: {
+          IROP_CASE(LUDIV): {
             auto Op = IROp->C<IR::IROp_LUDiv>();
             // Each source is OpSize in size
             // So you can have up to a 128bit divide from x86-64
             switch (OpSize) {
               case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
+                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
+                uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[2]);
                 uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
                 uint32_t Res = Source / Divisor;
 
@@ -3541,9 +3825,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
+                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
+                uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[2]);
                 uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
                 uint64_t Res = Source / Divisor;
 
@@ -3552,9 +3836,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
+                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
+                uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[2]);
                 __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
                 __uint128_t Res = Source / Divisor;
 
@@ -3564,17 +3848,17 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown LUDIV Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_LDIV: {
+          IROP_CASE(LDIV): {
             auto Op = IROp->C<IR::IROp_LDiv>();
             // Each source is OpSize in size
             // So you can have up to a 128bit divide from x86-64
             switch (OpSize) {
               case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                int16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
+                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
+                int16_t Divisor = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[2]);
                 int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
                 int32_t Res = Source / Divisor;
 
@@ -3583,9 +3867,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
+                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
+                int32_t Divisor = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[2]);
                 int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
                 int64_t Res = Source / Divisor;
 
@@ -3594,9 +3878,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(SSAData, Op->Header.Args[2]);
+                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
+                int64_t Divisor = *GetSrc<int64_t*>(SSAData, CurrentOp->Args[2]);
                 __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
                 __int128_t Res = Source / Divisor;
 
@@ -3606,17 +3890,17 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown LDIV Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_LUREM: {
+          IROP_CASE(LUREM): {
             auto Op = IROp->C<IR::IROp_LURem>();
             // Each source is OpSize in size
             // So you can have up to a 128bit Remainder from x86-64
             switch (OpSize) {
               case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
+                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
+                uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[2]);
                 uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
                 uint32_t Res = Source % Divisor;
 
@@ -3626,9 +3910,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
 
               case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
+                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
+                uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[2]);
                 uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
                 uint64_t Res = Source % Divisor;
 
@@ -3637,9 +3921,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
+                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
+                uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[2]);
                 __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
                 __uint128_t Res = Source % Divisor;
                 // We only store the lower bits of the result
@@ -3648,17 +3932,17 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown LUREM Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_LREM: {
+          IROP_CASE(LREM): {
             auto Op = IROp->C<IR::IROp_LRem>();
             // Each source is OpSize in size
             // So you can have up to a 128bit Remainder from x86-64
             switch (OpSize) {
               case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                int16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
+                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[1]);
+                int16_t Divisor = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[2]);
                 int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
                 int32_t Res = Source % Divisor;
 
@@ -3667,9 +3951,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
+                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[1]);
+                int32_t Divisor = *GetSrc<uint32_t*>(SSAData, CurrentOp->Args[2]);
                 int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
                 int64_t Res = Source % Divisor;
 
@@ -3678,9 +3962,9 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
                 break;
               }
               case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(SSAData, Op->Header.Args[2]);
+                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
+                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]);
+                int64_t Divisor = *GetSrc<int64_t*>(SSAData, CurrentOp->Args[2]);
                 __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
                 __int128_t Res = Source % Divisor;
                 // We only store the lower bits of the result
@@ -3689,12 +3973,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
               default: LogMan::Msg::A("Unknown LREM Size: %d", OpSize); break;
             }
-            break;
+            NEXT();
           }
-          case IR::OP_VEXTR: {
+          IROP_CASE(VEXTR): {
             auto Op = IROp->C<IR::IROp_VExtr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             uint64_t Offset = Op->Index * Op->Header.ElementSize * 8;
             __uint128_t Dst{};
@@ -3707,12 +3991,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, &Dst, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VINSGPR: {
+          IROP_CASE(VINSGPR): {
             auto Op = IROp->C<IR::IROp_VInsGPR>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             uint64_t Offset = Op->Index * Op->Header.ElementSize * 8;
             __uint128_t Mask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
@@ -3722,132 +4006,132 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             Dst |= Src2 << Offset;
 
             memcpy(GDP, &Dst, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_FLOAT_FROMGPR_S: {
+          IROP_CASE(FLOAT_FROMGPR_S): {
             auto Op = IROp->C<IR::IROp_Float_FromGPR_S>();
 
             uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
             switch (Conv) {
               case 0x0404: { // Float <- int32_t
-                float Dst = (float)*GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
+                float Dst = (float)*GetSrc<int32_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
               case 0x0408: { // Float <- int64_t
-                float Dst = (float)*GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+                float Dst = (float)*GetSrc<int64_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
               case 0x0804: { // Double <- int32_t
-                double Dst = (double)*GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
+                double Dst = (double)*GetSrc<int32_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
               case 0x0808: { // Double <- int64_t
-                double Dst = (double)*GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+                double Dst = (double)*GetSrc<int64_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
             }
-            break;
+            NEXT();
           }
-          case IR::OP_FLOAT_FROMGPR_U: {
+          IROP_CASE(FLOAT_FROMGPR_U): {
             auto Op = IROp->C<IR::IROp_Float_FromGPR_U>();
             uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
             switch (Conv) {
               case 0x0404: { // Float <- int32_t
-                float Dst = (float)*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+                float Dst = (float)*GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
               case 0x0408: { // Float <- int64_t
-                float Dst = (float)*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+                float Dst = (float)*GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
               case 0x0804: { // Double <- int32_t
-                double Dst = (double)*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+                double Dst = (double)*GetSrc<uint32_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
               case 0x0808: { // Double <- int64_t
-                double Dst = (double)*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+                double Dst = (double)*GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, Op->Header.ElementSize);
                 break;
               }
             }
-            break;
+            NEXT();
           }
-          case IR::OP_FLOAT_TOGPR_ZS: {
+          IROP_CASE(FLOAT_TOGPR_ZS): {
             auto Op = IROp->C<IR::IROp_Float_ToGPR_ZS>();
             if (Op->Header.ElementSize == 8) {
-              int64_t Dst = (int64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+              int64_t Dst = (int64_t)*GetSrc<double*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
             else {
-              int32_t Dst = (int32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+              int32_t Dst = (int32_t)*GetSrc<float*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_FLOAT_TOGPR_ZU: {
+          IROP_CASE(FLOAT_TOGPR_ZU): {
             auto Op = IROp->C<IR::IROp_Float_ToGPR_ZU>();
             if (Op->Header.ElementSize == 8) {
-              uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+              uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
             else {
-              uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+              uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_FLOAT_TOGPR_S: {
+          IROP_CASE(FLOAT_TOGPR_S): {
             auto Op = IROp->C<IR::IROp_Float_ToGPR_S>();
             if (Op->Header.ElementSize == 8) {
-              int64_t Dst = (int64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+              int64_t Dst = (int64_t)*GetSrc<double*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
             else {
-              int32_t Dst = (int32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+              int32_t Dst = (int32_t)*GetSrc<float*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_FLOAT_TOGPR_U: {
+          IROP_CASE(FLOAT_TOGPR_U): {
             auto Op = IROp->C<IR::IROp_Float_ToGPR_U>();
             if (Op->Header.ElementSize == 8) {
-              uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+              uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
             else {
-              uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+              uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, CurrentOp->Args[0]);
               memcpy(GDP, &Dst, Op->Header.ElementSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_FLOAT_FTOF: {
+          IROP_CASE(FLOAT_FTOF): {
             auto Op = IROp->C<IR::IROp_Float_FToF>();
             uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
             switch (Conv) {
               case 0x0804: { // Double <- Float
-                double Dst = (double)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+                double Dst = (double)*GetSrc<float*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, 8);
                 break;
               }
               case 0x0408: { // Float <- Double
-                float Dst = (float)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+                float Dst = (float)*GetSrc<double*>(SSAData, CurrentOp->Args[0]);
                 memcpy(GDP, &Dst, 4);
                 break;
               }
               default: LogMan::Msg::A("Unknown FCVT sizes: 0x%x", Conv);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_VECTOR_FTOF: {
+          IROP_CASE(VECTOR_FTOF): {
             auto Op = IROp->C<IR::IROp_Vector_FToF>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+            void *Src = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
             uint8_t Tmp[16]{};
 
             uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
@@ -3873,14 +4157,14 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               default: LogMan::Msg::A("Unknown Conversion Type : 0%04x", Conv); break;
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_FCMP: {
+          IROP_CASE(FCMP): {
             auto Op = IROp->C<IR::IROp_FCmp>();
             uint32_t ResultFlags{};
             if (Op->ElementSize == 4) {
-              float Src1 = *GetSrc<float*>(SSAData, Op->Header.Args[0]);
-              float Src2 = *GetSrc<float*>(SSAData, Op->Header.Args[1]);
+              float Src1 = *GetSrc<float*>(SSAData, CurrentOp->Args[0]);
+              float Src2 = *GetSrc<float*>(SSAData, CurrentOp->Args[1]);
               bool Unordered = std::isnan(Src1) || std::isnan(Src2);
               if (Op->Flags & (1 << FCMP_FLAG_LT)) {
                 if (Unordered || (Src1 < Src2)) {
@@ -3899,8 +4183,8 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
             }
             else {
-              double Src1 = *GetSrc<double*>(SSAData, Op->Header.Args[0]);
-              double Src2 = *GetSrc<double*>(SSAData, Op->Header.Args[1]);
+              double Src1 = *GetSrc<double*>(SSAData, CurrentOp->Args[0]);
+              double Src2 = *GetSrc<double*>(SSAData, CurrentOp->Args[1]);
               bool Unordered = std::isnan(Src1) || std::isnan(Src2);
               if (Op->Flags & (1 << FCMP_FLAG_LT)) {
                 if (Unordered || (Src1 < Src2)) {
@@ -3920,12 +4204,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             GD = ResultFlags;
-            break;
+            NEXT();
           }
-          case IR::OP_VTBL1: {
+          IROP_CASE(VTBL1): {
             auto Op = IROp->C<IR::IROp_VTBL1>();
-            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-            uint8_t *Src2 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
+            uint8_t *Src2 = GetSrc<uint8_t*>(SSAData, CurrentOp->Args[1]);
 
             uint8_t Tmp[16];
 
@@ -3934,13 +4218,53 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               Tmp[i] = Index >= OpSize ? 0 : Src1[Index];
             }
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
 
-          case IR::OP_GETHOSTFLAG: {
+          IROP_CASE(GETHOSTFLAG): {
             auto Op = IROp->C<IR::IROp_GetHostFlag>();
-            GD = (*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]) >> Op->Flag) & 1;
-            break;
+            GD = (*GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]) >> Op->Flag) & 1;
+            NEXT();
+          }
+          IROP_CASE(HOSTFLAGS): {
+            auto Op = IROp->C<IR::IROp_HostFlags>();
+            uint64_t Mask = Op->SrcSize == 8 ? ~0ULL : ((1ULL << (Op->SrcSize * 8)) - 1);
+            uint64_t SignBit = 1ULL << (Op->SrcSize * 8 - 1);
+            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[0]) & Mask;
+            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, CurrentOp->Args[1]) & Mask;
+            uint64_t Res{};
+            uint64_t CF{}, AF{}, OF{};
+
+            switch (Op->ALUOp) {
+              case IR::HOSTFLAGS_OP_ADD:
+                Res = (Src1 + Src2) & Mask;
+                CF = Res < Src1;
+                AF = ((Src1 ^ Src2 ^ Res) >> 4) & 1;
+                OF = (~(Src1 ^ Src2) & (Src1 ^ Res) & SignBit) != 0;
+                break;
+              case IR::HOSTFLAGS_OP_SUB:
+                Res = (Src1 - Src2) & Mask;
+                CF = Src1 < Src2;
+                AF = ((Src1 ^ Src2 ^ Res) >> 4) & 1;
+                OF = ((Src1 ^ Src2) & (Src1 ^ Res) & SignBit) != 0;
+                break;
+              case IR::HOSTFLAGS_OP_LOGIC:
+                Res = Src1 & Src2;
+                break;
+              default: LogMan::Msg::A("Unknown HostFlags op: %d", Op->ALUOp); break;
+            }
+
+            uint64_t PF = (__builtin_popcountll(Res & 0xFF) & 1) ^ 1;
+            uint64_t ZF = Res == 0;
+            uint64_t SF = (Res & SignBit) != 0;
+
+            GD = (CF << X86State::RFLAG_CF_LOC) |
+                 (PF << X86State::RFLAG_PF_LOC) |
+                 (AF << X86State::RFLAG_AF_LOC) |
+                 (ZF << X86State::RFLAG_ZF_LOC) |
+                 (SF << X86State::RFLAG_SF_LOC) |
+                 (OF << X86State::RFLAG_OF_LOC);
+            NEXT();
           }
           #define DO_SCALAR_COMPARE_OP(size, type, type2, func)              \
             case size: {                                      \
@@ -3962,10 +4286,10 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             break;                                            \
             }
 
-          case IR::OP_VFCMPEQ: {
+          IROP_CASE(VFCMPEQ): {
             auto Op = IROp->C<IR::IROp_VFCMPEQ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
 
@@ -3988,12 +4312,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFCMPNEQ: {
+          IROP_CASE(VFCMPNEQ): {
             auto Op = IROp->C<IR::IROp_VFCMPNEQ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             auto Func = [](auto a, auto b) { return a != b ? ~0ULL : 0; };
 
@@ -4016,12 +4340,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFCMPLT: {
+          IROP_CASE(VFCMPLT): {
             auto Op = IROp->C<IR::IROp_VFCMPLT>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
 
@@ -4044,12 +4368,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFCMPLE: {
+          IROP_CASE(VFCMPLE): {
             auto Op = IROp->C<IR::IROp_VFCMPLE>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             auto Func = [](auto a, auto b) { return a <= b ? ~0ULL : 0; };
 
@@ -4072,12 +4396,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFCMPUNO: {
+          IROP_CASE(VFCMPUNO): {
             auto Op = IROp->C<IR::IROp_VFCMPUNO>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             auto Func = [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)) ? ~0ULL : 0; };
 
@@ -4100,12 +4424,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VFCMPORD: {
+          IROP_CASE(VFCMPORD): {
             auto Op = IROp->C<IR::IROp_VFCMPORD>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+            void *Src1 = GetSrc<void*>(SSAData, CurrentOp->Args[0]);
+            void *Src2 = GetSrc<void*>(SSAData, CurrentOp->Args[1]);
 
             auto Func = [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)) ? ~0ULL : 0; };
 
@@ -4128,23 +4452,23 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             memcpy(GDP, Tmp, OpSize);
-            break;
+            NEXT();
           }
-          case IR::OP_VAESIMC: {
+          IROP_CASE(VAESIMC): {
             auto Op = IROp->C<IR::IROp_VAESImc>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
 
             // Pseudo-code
             // Dst = InvMixColumns(STATE)
             __uint128_t Tmp{};
             Tmp = AES::InvMixColumns(reinterpret_cast<uint8_t*>(&Src1));
             memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
+            NEXT();
           }
-          case IR::OP_VAESENC: {
+          IROP_CASE(VAESENC): {
             auto Op = IROp->C<IR::IROp_VAESEnc>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             // Pseudo-code
             // STATE = Src1
@@ -4159,12 +4483,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             Tmp = AES::MixColumns(reinterpret_cast<uint8_t*>(&Tmp));
             Tmp = Tmp ^ Src2;
             memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
+            NEXT();
           }
-          case IR::OP_VAESENCLAST: {
+          IROP_CASE(VAESENCLAST): {
             auto Op = IROp->C<IR::IROp_VAESEncLast>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             // Pseudo-code
             // STATE = Src1
@@ -4177,12 +4501,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             Tmp = AES::SubBytes(reinterpret_cast<uint8_t*>(&Tmp), 16);
             Tmp = Tmp ^ Src2;
             memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
+            NEXT();
           }
-          case IR::OP_VAESDEC: {
+          IROP_CASE(VAESDEC): {
             auto Op = IROp->C<IR::IROp_VAESDec>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             // Pseudo-code
             // STATE = Src1
@@ -4197,12 +4521,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             Tmp = AES::InvMixColumns(reinterpret_cast<uint8_t*>(&Tmp));
             Tmp = Tmp ^ Src2;
             memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
+            NEXT();
           }
-          case IR::OP_VAESDECLAST: {
+          IROP_CASE(VAESDECLAST): {
             auto Op = IROp->C<IR::IROp_VAESDecLast>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[0]);
+            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, CurrentOp->Args[1]);
 
             // Pseudo-code
             // STATE = Src1
@@ -4215,11 +4539,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             Tmp = AES::InvSubBytes(reinterpret_cast<uint8_t*>(&Tmp));
             Tmp = Tmp ^ Src2;
             memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
+            NEXT();
           }
-          case IR::OP_VAESKEYGENASSIST: {
+          IROP_CASE(VAESKEYGENASSIST): {
             auto Op = IROp->C<IR::IROp_VAESKeyGenAssist>();
-            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
 
             // Pseudo-code
             // X3 = Src1[127:96]
@@ -4256,101 +4580,101 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             Tmp <<= 32;
             Tmp |= SubWord_X1;
             memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
+            NEXT();
           }
-          case IR::OP_F80ADD: {
+          IROP_CASE(F80ADD): {
             auto Op = IROp->C<IR::IROp_F80Add>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FADD(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80SUB: {
+          IROP_CASE(F80SUB): {
             auto Op = IROp->C<IR::IROp_F80Sub>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FSUB(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80MUL: {
+          IROP_CASE(F80MUL): {
             auto Op = IROp->C<IR::IROp_F80Mul>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FMUL(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80DIV: {
+          IROP_CASE(F80DIV): {
             auto Op = IROp->C<IR::IROp_F80Div>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FDIV(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80FYL2X: {
+          IROP_CASE(F80FYL2X): {
             auto Op = IROp->C<IR::IROp_F80FYL2X>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FYL2X(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80ATAN: {
+          IROP_CASE(F80ATAN): {
             auto Op = IROp->C<IR::IROp_F80ATAN>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FATAN(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80FPREM1: {
+          IROP_CASE(F80FPREM1): {
             auto Op = IROp->C<IR::IROp_F80FPREM1>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FREM1(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80FPREM: {
+          IROP_CASE(F80FPREM): {
             auto Op = IROp->C<IR::IROp_F80FPREM>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FREM(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80SCALE: {
+          IROP_CASE(F80SCALE): {
             auto Op = IROp->C<IR::IROp_F80SCALE>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FSCALE(Src1, Src2);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80CVT: {
+          IROP_CASE(F80CVT): {
             auto Op = IROp->C<IR::IROp_F80CVT>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
 
             switch (OpSize) {
               case 4: {
@@ -4365,11 +4689,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
             default: LogMan::Msg::D("Unhandled size: %d", OpSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_F80CVTINT: {
+          IROP_CASE(F80CVTINT): {
             auto Op = IROp->C<IR::IROp_F80CVTInt>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
 
             switch (OpSize) {
               case 2: {
@@ -4389,121 +4713,121 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               }
             default: LogMan::Msg::D("Unhandled size: %d", OpSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_F80CVTTO: {
+          IROP_CASE(F80CVTTO): {
             auto Op = IROp->C<IR::IROp_F80CVTTo>();
 
             switch (Op->Size) {
               case 4: {
-                float Src = *GetSrc<float *>(SSAData, Op->Header.Args[0]);
+                float Src = *GetSrc<float *>(SSAData, CurrentOp->Args[0]);
                 X80SoftFloat Tmp = Src;
                 memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
                 break;
               }
               case 8: {
-                double Src = *GetSrc<double *>(SSAData, Op->Header.Args[0]);
+                double Src = *GetSrc<double *>(SSAData, CurrentOp->Args[0]);
                 X80SoftFloat Tmp = Src;
                 memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
                 break;
               }
             default: LogMan::Msg::D("Unhandled size: %d", OpSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_F80CVTTOINT: {
+          IROP_CASE(F80CVTTOINT): {
             auto Op = IROp->C<IR::IROp_F80CVTToInt>();
 
             switch (Op->Size) {
               case 2: {
-                int16_t Src = *GetSrc<int16_t*>(SSAData, Op->Header.Args[0]);
+                int16_t Src = *GetSrc<int16_t*>(SSAData, CurrentOp->Args[0]);
                 X80SoftFloat Tmp = Src;
                 memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
                 break;
               }
               case 4: {
-                int32_t Src = *GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
+                int32_t Src = *GetSrc<int32_t*>(SSAData, CurrentOp->Args[0]);
                 X80SoftFloat Tmp = Src;
                 memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
                 break;
               }
             default: LogMan::Msg::D("Unhandled size: %d", OpSize);
             }
-            break;
+            NEXT();
           }
-          case IR::OP_F80ROUND: {
+          IROP_CASE(F80ROUND): {
             auto Op = IROp->C<IR::IROp_F80Round>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FRNDINT(Src);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80F2XM1: {
+          IROP_CASE(F80F2XM1): {
             auto Op = IROp->C<IR::IROp_F80F2XM1>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::F2XM1(Src);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80TAN: {
+          IROP_CASE(F80TAN): {
             auto Op = IROp->C<IR::IROp_F80TAN>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FTAN(Src);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80SQRT: {
+          IROP_CASE(F80SQRT): {
             auto Op = IROp->C<IR::IROp_F80SQRT>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FSQRT(Src);
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80SIN: {
+          IROP_CASE(F80SIN): {
             auto Op = IROp->C<IR::IROp_F80SIN>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FSIN(Src);
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80COS: {
+          IROP_CASE(F80COS): {
             auto Op = IROp->C<IR::IROp_F80COS>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FCOS(Src);
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80XTRACT_EXP: {
+          IROP_CASE(F80XTRACT_EXP): {
             auto Op = IROp->C<IR::IROp_F80XTRACT_EXP>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FXTRACT_EXP(Src);
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80XTRACT_SIG: {
+          IROP_CASE(F80XTRACT_SIG): {
             auto Op = IROp->C<IR::IROp_F80XTRACT_SIG>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             X80SoftFloat Tmp;
             Tmp = X80SoftFloat::FXTRACT_SIG(Src);
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80CMP: {
+          IROP_CASE(F80CMP): {
             auto Op = IROp->C<IR::IROp_F80Cmp>();
             uint32_t ResultFlags{};
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
+            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[1]);
             bool eq, lt, nan;
             X80SoftFloat::FCMP(Src1, Src2, &eq, &lt, &nan);
             if (Op->Flags & (1 << FCMP_FLAG_LT) &&
@@ -4520,11 +4844,11 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             }
 
             GD = ResultFlags;
-            break;
+            NEXT();
           }
-          case IR::OP_GETROUNDINGMODE: {
+          IROP_CASE(GETROUNDINGMODE): {
             uint32_t GuestRounding{};
-#ifdef _M_ARM_64
+    #ifdef _M_ARM_64
             uint64_t Tmp{};
             __asm(R"(
               mrs %[Tmp], FPCR;
@@ -4542,20 +4866,20 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               GuestRounding |= ROUND_MODE_NEGATIVE_INFINITY;
             else if (RoundingMode == 3)
               GuestRounding |= ROUND_MODE_TOWARDS_ZERO;
-#else
+    #else
             GuestRounding = _mm_getcsr();
 
             // Extract the rounding
             GuestRounding = (GuestRounding >> 13) & 0b111;
-#endif
+    #endif
             memcpy(GDP, &GuestRounding, sizeof(GuestRounding));
-            break;
+            NEXT();
           }
 
-          case IR::OP_SETROUNDINGMODE: {
+          IROP_CASE(SETROUNDINGMODE): {
             auto Op = IROp->C<IR::IROp_SetRoundingMode>();
-            uint8_t GuestRounding = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-#ifdef _M_ARM_64
+            uint8_t GuestRounding = *GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
+    #ifdef _M_ARM_64
             uint64_t HostRounding{};
             __asm volatile(R"(
               mrs %[Tmp], FPCR;
@@ -4580,7 +4904,7 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
               msr FPCR, %[Tmp];
             )"
             :: [Tmp] "r" (HostRounding));
-#else
+    #else
             uint32_t HostRounding = _mm_getcsr();
 
             // Cut out the host rounding mode
@@ -4589,12 +4913,12 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             // Insert our new rounding mode
             HostRounding |= GuestRounding << 13;
             _mm_setcsr(HostRounding);
-#endif
-            break;
+    #endif
+            NEXT();
           }
-          case IR::OP_F80BCDLOAD: {
+          IROP_CASE(F80BCDLOAD): {
             auto Op = IROp->C<IR::IROp_F80BCDLoad>();
-            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, CurrentOp->Args[0]);
             uint64_t BCD{};
             // We walk through each uint8_t and pull out the BCD encoding
             // Each 4bit split is a digit
@@ -4625,11 +4949,20 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             Tmp.Sign = Negative;
 
             memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
+            NEXT();
           }
-          case IR::OP_F80BCDSTORE: {
+          IROP_CASE(F80LOADFCW): {
+            auto Op = IROp->C<IR::IROp_F80LoadFCW>();
+            uint16_t NewFCW = *GetSrc<uint16_t*>(SSAData, CurrentOp->Args[0]);
+            if (NewFCW != AppliedFCW) {
+              AppliedFCW = NewFCW;
+              X80SoftFloat::SetControlWord(NewFCW);
+            }
+            NEXT();
+          }
+          IROP_CASE(F80BCDSTORE): {
             auto Op = IROp->C<IR::IROp_F80BCDStore>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, CurrentOp->Args[0]);
             bool Negative = Src1.Sign;
 
             // Clear the Sign bit
@@ -4660,35 +4993,57 @@ void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
             BCD[9] = Negative ? 0x80 : 0;
 
             memcpy(GDP, BCD, 10);
-            break;
+            NEXT();
           }
           default:
+          Op_Unhandled:
             LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
             break;
         }
-
-        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
-        if (CodeBegin == CodeLast) {
-          break;
-        }
-        ++CodeBegin;
       }
+
+#undef NEXT
+    ProgramExit:
+      return CurrentOp;
     };
 
-    HandleBlock(BlockNode);
+    auto ExitOp = RunProgram();
 
-    if (BlockResults.Redo) {
-      continue;
+    PendingInstructions += Program->GuestInstructionCount;
+    if (PendingInstructions >= STATS_FLUSH_THRESHOLD) {
+      FlushStats();
     }
 
-    if (BlockResults.Quit || ++BlockIterator == BlockEnd) {
+    if (!ChainBlocks) {
       break;
     }
+
+    // Keep running interpreted blocks here instead of going back out through the dispatcher
+    // Each exit caches where it went last, so constant targets only ever resolve once
+    auto &Link = Program->Links[ExitOp->Target[0]];
+    uint64_t RIP = Thread->State.State.rip;
+
+    if (Link.Epoch != LinkEpoch || Link.RIP != RIP) {
+      auto Next = FindProgram(RIP, true);
+      if (Next || Thread->IRLists.find(RIP) != Thread->IRLists.end()) {
+        // Native code isn't going to turn in to an interpreted block, remember that too
+        Link = {RIP, Next, LinkEpoch};
+      }
+      else {
+        // Not compiled yet, the dispatcher needs to do that
+        break;
+      }
+    }
+
+    if (!Link.Program) {
+      break;
+    }
+
+    Program = Link.Program;
   }
 
-  auto DebugData = Thread->DebugData.find(Thread->State.State.rip);
-  if (DebugData != Thread->DebugData.end()) {
-    Thread->Stats.InstructionsExecuted.fetch_add(DebugData->second.GuestInstructionCount);
+  if (AppliedFCW != ~0U) {
+    X80SoftFloat::RestoreHostControlWord();
   }
 }
 
@@ -238,6 +238,52 @@ DEF_OP(Thunk) {
   add(sp, sp, SPOffset);
 }
 
+DEF_OP(DirectSyscall) {
+  auto Op = IROp->C<IR::IROp_DirectSyscall>();
+  // Arguments are passed as follows:
+  // X0: ThreadState
+  // X1-X6: Syscall arguments
+
+  const std::array<aarch64::Register, 6> ArgRegs = { x1, x2, x3, x4, x5, x6 };
+  uint64_t SPOffset = AlignUp((RA64.size() + ArgRegs.size() + 1) * 8, 16);
+
+  sub(sp, sp, SPOffset);
+
+  // Arguments can live in registers that overlap the argument registers, bounce them through the stack
+  for (uint32_t i = 0; i < Op->NumArgs; ++i) {
+    str(GetReg<RA_64>(Op->Header.Args[i].ID()), MemOperand(sp, i * 8));
+  }
+
+  int i = 0;
+  for (auto RA : RA64) {
+    str(RA, MemOperand(sp, ArgRegs.size() * 8 + i * 8));
+    i++;
+  }
+  str(lr,       MemOperand(sp, ArgRegs.size() * 8 + RA64.size() * 8 + 0 * 8));
+
+  for (uint32_t i = 0; i < Op->NumArgs; ++i) {
+    ldr(ArgRegs[i], MemOperand(sp, i * 8));
+  }
+  mov(x0, STATE);
+
+  LoadConstant(x7, Op->HandlerFnPtr);
+  blr(x7);
+
+  // Result is now in x0
+  // Fix the stack and any values that were stepped on
+  i = 0;
+  for (auto RA : RA64) {
+    ldr(RA, MemOperand(sp, ArgRegs.size() * 8 + i * 8));
+    i++;
+  }
+
+  // Move result to its destination register
+  mov(GetReg<RA_64>(Node), x0);
+
+  ldr(lr,       MemOperand(sp, ArgRegs.size() * 8 + RA64.size() * 8 + 0 * 8));
+
+  add(sp, sp, SPOffset);
+}
 
 DEF_OP(ValidateCode) {
   auto Op = IROp->C<IR::IROp_ValidateCode>();
@@ -248,6 +294,20 @@ DEF_OP(ValidateCode) {
 
   LoadConstant(GetReg<RA_64>(Node), 0);
   LoadConstant(x0, Op->CodePtr);
+
+  if (len == 16) {
+    // The frontend hands us the block in 16 byte chunks, fold each chunk's differences in to one compare
+    ldp(x2, x3, MemOperand(x0));
+    LoadConstant(x1, *(uint64_t *)OldCode);
+    eor(x2, x2, x1);
+    LoadConstant(x1, *(uint64_t *)(OldCode + 8));
+    eor(x3, x3, x1);
+    orr(x2, x2, x3);
+    cmp(x2, 0);
+    cset(GetReg<RA_64>(Node), Condition::ne);
+    return;
+  }
+
   LoadConstant(x1, 1);
 
   while (len >= 4)
@@ -373,6 +433,7 @@ void JITCore::RegisterBranchHandlers() {
   REGISTER_OP(CONDJUMP,          CondJump);
   REGISTER_OP(SYSCALL,           Syscall);
   REGISTER_OP(THUNK,             Thunk);
+  REGISTER_OP(DIRECTSYSCALL,     DirectSyscall);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(REMOVECODEENTRY,   RemoveCodeEntry);
   REGISTER_OP(CPUID,             CPUID);
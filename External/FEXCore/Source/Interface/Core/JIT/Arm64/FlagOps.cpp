@@ -1,4 +1,5 @@
 #include "Interface/Core/JIT/Arm64/JITClass.h"
+#include <FEXCore/Core/X86Enums.h>
 
 namespace FEXCore::CPU {
 
@@ -10,10 +11,87 @@ DEF_OP(GetHostFlag) {
   ubfx(GetReg<RA_64>(Node), GetReg<RA_64>(Op->Header.Args[0].ID()), Op->Flag, 1);
 }
 
+DEF_OP(HostFlags) {
+  auto Op = IROp->C<IR::IROp_HostFlags>();
+  uint8_t Bits = Op->SrcSize * 8;
+
+  // The sources can be read in full before Dst is written, after that it accumulates the flags
+  auto Dst = GetReg<RA_64>(Node);
+  ubfx(TMP1, GetReg<RA_64>(Op->Header.Args[0].ID()), 0, Bits);
+  ubfx(TMP2, GetReg<RA_64>(Op->Header.Args[1].ID()), 0, Bits);
+
+  switch (Op->ALUOp) {
+    case IR::HOSTFLAGS_OP_ADD:
+    case IR::HOSTFLAGS_OP_SUB: {
+      bool IsAdd = Op->ALUOp == IR::HOSTFLAGS_OP_ADD;
+      if (IsAdd) {
+        adds(TMP3, TMP1, TMP2);
+        cset(Dst, Condition::cs);
+        if (Bits != 64) {
+          // The carry out is the bit above the operation
+          ubfx(Dst, TMP3, Bits, 1);
+        }
+      }
+      else {
+        cmp(TMP1, TMP2);
+        cset(Dst, Condition::lo);
+        sub(TMP3, TMP1, TMP2);
+      }
+
+      if (Bits != 64) {
+        ubfx(TMP3, TMP3, 0, Bits);
+      }
+
+      // AF
+      eor(TMP4, TMP1, TMP2);
+      eor(TMP4, TMP4, TMP3);
+      ubfx(TMP4, TMP4, 4, 1);
+      orr(Dst, Dst, Operand(TMP4, LSL, X86State::RFLAG_AF_LOC));
+
+      // OF
+      eor(TMP4, TMP1, TMP3);
+      eor(TMP1, TMP1, TMP2);
+      if (IsAdd) {
+        bic(TMP4, TMP4, TMP1);
+      }
+      else {
+        and_(TMP4, TMP4, TMP1);
+      }
+      ubfx(TMP4, TMP4, Bits - 1, 1);
+      orr(Dst, Dst, Operand(TMP4, LSL, X86State::RFLAG_OF_LOC));
+      break;
+    }
+    case IR::HOSTFLAGS_OP_LOGIC:
+      and_(TMP3, TMP1, TMP2);
+      mov(Dst, 0);
+      break;
+    default: LogMan::Msg::A("Unknown HostFlags op: %d", Op->ALUOp); break;
+  }
+
+  // PF, set when the low byte has even parity
+  ubfx(TMP4, TMP3, 0, 8);
+  eor(TMP4, TMP4, Operand(TMP4, LSR, 4));
+  eor(TMP4, TMP4, Operand(TMP4, LSR, 2));
+  eor(TMP4, TMP4, Operand(TMP4, LSR, 1));
+  mvn(TMP4, TMP4);
+  and_(TMP4, TMP4, 1);
+  orr(Dst, Dst, Operand(TMP4, LSL, X86State::RFLAG_PF_LOC));
+
+  // ZF
+  cmp(TMP3, 0);
+  cset(TMP4, Condition::eq);
+  orr(Dst, Dst, Operand(TMP4, LSL, X86State::RFLAG_ZF_LOC));
+
+  // SF
+  ubfx(TMP4, TMP3, Bits - 1, 1);
+  orr(Dst, Dst, Operand(TMP4, LSL, X86State::RFLAG_SF_LOC));
+}
+
 #undef DEF_OP
 void JITCore::RegisterFlagHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &JITCore::Op_##x
   REGISTER_OP(GETHOSTFLAG, GetHostFlag);
+  REGISTER_OP(HOSTFLAGS,   HostFlags);
 #undef REGISTER_OP
 }
 }
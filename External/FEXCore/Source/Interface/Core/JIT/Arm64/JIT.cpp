@@ -1,4 +1,5 @@
 #include "Interface/Context/Context.h"
+#include "Interface/Core/BlockSamplingData.h"
 
 #include "Interface/Core/JIT/Arm64/JITClass.h"
 #include "Interface/Core/InternalThreadState.h"
@@ -460,6 +461,7 @@ JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadSt
   , InitialCodeBuffer {Buffer}
 {
   CurrentCodeBuffer = &InitialCodeBuffer;
+  PublishCodeRange(PUBLISHED_CODE_INITIAL, InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
   ThreadSharedData.SignalHandlerRefCounterPtr = &SignalHandlerRefCounter;
 
   auto Features = vixl::CPUFeatures::InferFromOS();
@@ -555,6 +557,7 @@ void JITCore::ClearCache() {
     if (!CodeBuffers.empty()) {
       // If we have more than one code buffer we are tracking then walk them and delete
       // This is a cleanup step
+      PublishCodeRange(PUBLISHED_CODE_CURRENT, nullptr, 0);
       for (auto CodeBuffer : CodeBuffers) {
         FreeCodeBuffer(CodeBuffer);
       }
@@ -570,6 +573,7 @@ void JITCore::ClearCache() {
       Buffer->Reset();
     }
     else {
+      PublishCodeRange(PUBLISHED_CODE_INITIAL, nullptr, 0);
       FreeCodeBuffer(InitialCodeBuffer);
 
       // Resize the code buffer and reallocate our code size
@@ -578,6 +582,7 @@ void JITCore::ClearCache() {
 
       InitialCodeBuffer = JITCore::AllocateNewCodeBuffer(InitialCodeBuffer.Size);
       *Buffer = vixl::CodeBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
+      PublishCodeRange(PUBLISHED_CODE_INITIAL, InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
     }
   }
   else {
@@ -587,6 +592,7 @@ void JITCore::ClearCache() {
     auto NewCodeBuffer = JITCore::AllocateNewCodeBuffer(JITCore::INITIAL_CODE_SIZE);
     EmplaceNewCodeBuffer(NewCodeBuffer);
     *Buffer = vixl::CodeBuffer(NewCodeBuffer.Ptr, NewCodeBuffer.Size);
+    PublishCodeRange(PUBLISHED_CODE_CURRENT, NewCodeBuffer.Ptr, NewCodeBuffer.Size);
   }
 }
 
@@ -745,7 +751,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
   if (SpillSlots) {
     add(TMP1, sp, 0); // Move that supports SP
-    sub(sp, sp, SpillSlots * 16);
+    sub(sp, sp, SpillSlots * 8);
     stp(TMP1, lr, MemOperand(sp, -16, PreIndex));
   }
   else {
@@ -753,6 +759,16 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
     stp(TMP1, lr, MemOperand(sp, -16, PreIndex));
   }
 
+  if (DebugData && DebugData->ProfileIndex != BlockSamplingData::NO_PROFILE_INDEX) {
+    // Block profiling, one increment per entry in to this thread's dense counter array
+    ldr(TMP1, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, BlockCounters)));
+    LoadConstant(TMP2, DebugData->ProfileIndex * sizeof(uint64_t));
+    add(TMP1, TMP1, TMP2);
+    ldr(TMP2, MemOperand(TMP1));
+    add(TMP2, TMP2, 1);
+    str(TMP2, MemOperand(TMP1));
+  }
+
   PendingTargetLabel = nullptr;
 
   for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
@@ -902,6 +918,7 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   // Dispatcher lives outside of traditional space-time
   DispatcherCodeBuffer = JITCore::AllocateNewCodeBuffer(MAX_DISPATCHER_CODE_SIZE);
   *GetBuffer() = vixl::CodeBuffer(DispatcherCodeBuffer.Ptr, DispatcherCodeBuffer.Size);
+  PublishCodeRange(PUBLISHED_CODE_DISPATCHER, DispatcherCodeBuffer.Ptr, DispatcherCodeBuffer.Size);
 
   auto Buffer = GetBuffer();
 
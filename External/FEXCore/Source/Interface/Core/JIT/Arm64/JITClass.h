@@ -333,6 +333,7 @@ private:
   DEF_OP(CondJump);
   DEF_OP(Syscall);
   DEF_OP(Thunk);
+  DEF_OP(DirectSyscall);
   DEF_OP(ValidateCode);
   DEF_OP(RemoveCodeEntry);
   DEF_OP(CPUID);
@@ -353,6 +354,7 @@ private:
 
   ///< Flag ops
   DEF_OP(GetHostFlag);
+  DEF_OP(HostFlags);
 
   ///< Memory ops
   DEF_OP(LoadContextPair);
@@ -127,6 +127,8 @@ void JITCore::RegisterMiscHandlers() {
   REGISTER_OP(GETROUNDINGMODE, GetRoundingMode);
   REGISTER_OP(SETROUNDINGMODE, SetRoundingMode);
   REGISTER_OP(INVALIDATEFLAGS,   NoOp);
+  // x87 state only matters to the interpreter, it syncs the FCW from the context on block entry
+  REGISTER_OP(F80LOADFCW,        NoOp);
 #undef REGISTER_OP
 }
 }
@@ -426,6 +426,17 @@ DEF_OP(Lshl) {
         break;
       default: LogMan::Msg::A("Unknown LSHL Size: %d\n", OpSize); break;
     };
+  } else if (Features.SupportsBMI2) {
+    // BMI2 shifts mask the count themselves and don't need it in cl
+    switch (OpSize) {
+      case 4:
+        shlx(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()));
+        break;
+      case 8:
+        shlx(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        break;
+      default: LogMan::Msg::A("Unknown LSHL Size: %d\n", OpSize); break;
+    };
   } else {
     mov(rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
     and(rcx, Mask);
@@ -474,6 +485,16 @@ DEF_OP(Lshr) {
       default: LogMan::Msg::A("Unknown Size: %d\n", OpSize); break;
     };
 
+  } else if (Features.SupportsBMI2 && OpSize >= 4) {
+    switch (OpSize) {
+      case 4:
+        shrx(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()));
+        break;
+      case 8:
+        shrx(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        break;
+      default: LogMan::Msg::A("Unknown Size: %d\n", OpSize); break;
+    };
   } else {
     mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
     and(rcx, Mask);
@@ -532,6 +553,16 @@ DEF_OP(Ashr) {
     default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
     };
 
+  } else if (Features.SupportsBMI2 && OpSize >= 4) {
+    switch (OpSize) {
+    case 4:
+      sarx(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()));
+    break;
+    case 8:
+      sarx(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+    break;
+    default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
+    };
   } else {
     mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
     and(rcx, Mask);
@@ -566,6 +597,20 @@ DEF_OP(Ror) {
   uint8_t Mask = OpSize * 8 - 1;
 
   uint64_t Const;
+  if (Features.SupportsBMI2 && IsInlineConstant(Op->Header.Args[1], &Const)) {
+    // Non-destructive and leaves the flags alone
+    Const &= Mask;
+    switch (OpSize) {
+      case 4:
+        rorx(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), Const);
+        return;
+      case 8:
+        rorx(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const);
+        return;
+      default: break;
+    }
+  }
+
   if (IsInlineConstant(Op->Header.Args[1], &Const)) {
     Const &= Mask;
     switch (OpSize) {
@@ -787,6 +832,15 @@ DEF_OP(Popcount) {
 DEF_OP(FindLSB) {
   auto Op = IROp->C<IR::IROp_FindLSB>();
 
+  if (Features.SupportsBMI1) {
+    // tzcnt sets CF on a zero source, which turns the result in to -1
+    tzcnt(rcx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+    sbb(rax, rax);
+    or(rax, rcx);
+    mov(GetDst<RA_64>(Node), rax);
+    return;
+  }
+
   bsf(rcx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
   mov(rax, 0x40);
   cmovz(rcx, rax);
@@ -820,6 +874,23 @@ DEF_OP(FindTrailingZeros) {
   auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
   uint8_t OpSize = IROp->Size;
 
+  if (Features.SupportsBMI1) {
+    // tzcnt already returns the operand size for zero
+    switch (OpSize) {
+      case 2:
+        tzcnt(GetDst<RA_16>(Node), GetSrc<RA_16>(Op->Header.Args[0].ID()));
+        break;
+      case 4:
+        tzcnt(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()));
+        break;
+      case 8:
+        tzcnt(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+        break;
+      default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
+    }
+    return;
+  }
+
   switch (OpSize) {
     case 2:
       bsf(GetDst<RA_16>(Node), GetSrc<RA_16>(Op->Header.Args[0].ID()));
@@ -844,7 +915,7 @@ DEF_OP(CountLeadingZeroes) {
   auto Op = IROp->C<IR::IROp_CountLeadingZeroes>();
   uint8_t OpSize = IROp->Size;
 
-  if (Features.has(Xbyak::util::Cpu::tLZCNT)) {
+  if (Features.SupportsLZCNT) {
     switch (OpSize) {
       case 2: {
         lzcnt(GetDst<RA_16>(Node), GetSrc<RA_16>(Op->Header.Args[0].ID()));
@@ -980,6 +1051,13 @@ DEF_OP(Bfe) {
     }
   }
 
+  if (Features.SupportsBMI1) {
+    // Control is the start bit in [7:0] and the length in [15:8]
+    mov(eax, (Op->Width << 8) | Op->lsb);
+    bextr(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()), rax);
+    return;
+  }
+
   mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
 
   if (Op->lsb != 0)
@@ -21,7 +21,7 @@ DEF_OP(GuestReturn) {
 DEF_OP(SignalReturn) {
   // Adjust the stack first for a regular return
   if (SpillSlots) {
-    add(rsp, SpillSlots * 16 + 8 + 8); // + 8 to consume return address
+    add(rsp, SpillSlots * 8 + 8 + 8); // + 8 to consume return address
   }
   else {
     add(rsp, 8 + 8); // + 8 to consume return address
@@ -34,7 +34,7 @@ DEF_OP(SignalReturn) {
 DEF_OP(CallbackReturn) {
   // Adjust the stack first for a regular return
   if (SpillSlots) {
-    add(rsp, SpillSlots * 16 + 8 + 8); // + 8 to consume return address
+    add(rsp, SpillSlots * 8 + 8 + 8); // + 8 to consume return address
   }
   else {
     add(rsp, 8 + 8); // + 8 to consume return address
@@ -63,15 +63,12 @@ DEF_OP(CallbackReturn) {
 
 DEF_OP(ExitFunction) {
   if (SpillSlots) {
-    add(rsp, SpillSlots * 16 + 8);
+    add(rsp, SpillSlots * 8 + 8);
   }
   else {
     add(rsp, 8);
   }
 
-#ifdef BLOCKSTATS
-  ExitBlock();
-#endif
   ret();
 }
 
@@ -138,12 +135,8 @@ DEF_OP(CondJump) {
 
 DEF_OP(Syscall) {
   auto Op = IROp->C<IR::IROp_Syscall>();
-  // XXX: This is very terrible, but I don't care for right now
 
-  auto NumPush = RA64.size();
-
-  for (auto &Reg : RA64)
-    push(Reg);
+  auto SaveState = PushCallerSaved(Node);
 
   // Syscall ABI for x86-64
   // this: rdi
@@ -153,59 +146,107 @@ DEF_OP(Syscall) {
   // Result: RAX
 
   // These are pushed in reverse order because stacks
+  uint32_t ArgStackSize = 0;
   for (uint32_t i = FEXCore::HLE::SyscallArguments::MAX_ARGS; i > 0; --i) {
     if (Op->Header.Args[i - 1].IsInvalid()) continue;
     push(GetSrc<RA_64>(Op->Header.Args[i - 1].ID()));
-    ++NumPush;
+    ArgStackSize += 8;
   }
 
   mov(rsi, STATE); // Move thread in to rsi
   mov(rdi, reinterpret_cast<uint64_t>(CTX->SyscallHandler));
   mov(rdx, rsp);
 
-  mov(rax, reinterpret_cast<uint64_t>(FEXCore::Context::HandleSyscall));
-
-  if (NumPush & 1)
-    sub(rsp, 8); // Align
   // {rdi, rsi, rdx}
-  call(rax);
+  // Arguments that are still live were saved above, so the pushed copies are just dropped
+  CallHostFunction(reinterpret_cast<uint64_t>(FEXCore::Context::HandleSyscall), ArgStackSize);
+
+  PopCallerSaved(SaveState);
+
+  mov (GetDst<RA_64>(Node), rax);
+}
+
+DEF_OP(Thunk) {
+  auto Op = IROp->C<IR::IROp_Thunk>();
 
-  if (NumPush & 1)
-    add(rsp, 8); // Align
+  auto SaveState = PushCallerSaved(Node);
+
+  mov(rdi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+
+  CallHostFunction(reinterpret_cast<uintptr_t>(Op->ThunkFnPtr));
+
+  PopCallerSaved(SaveState);
+}
 
-  // Reload arguments just in case they are sill live after the fact
-  for (uint32_t i = 0; i < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++i) {
-    if (Op->Header.Args[i].IsInvalid()) continue;
-    pop(GetSrc<RA_64>(Op->Header.Args[i].ID()));
+DEF_OP(DirectSyscall) {
+  auto Op = IROp->C<IR::IROp_DirectSyscall>();
+
+  auto SaveState = PushCallerSaved(Node);
+
+  // Handler ABI
+  // Thread: rdi
+  // Args: rsi, rdx, rcx, r8, r9, stack
+  //
+  // Result: RAX
+  const std::array<Xbyak::Reg, 5> ArgRegs = { rsi, rdx, rcx, r8, r9 };
+
+  // The sixth argument is passed on the stack, keep the padding above it
+  uint32_t ArgStackSize = 0;
+  if (Op->NumArgs > ArgRegs.size()) {
+    sub(rsp, 8);
+    ArgStackSize += 8;
   }
 
-  for (uint32_t i = RA64.size(); i > 0; --i)
-    pop(RA64[i - 1]);
+  // Arguments live in registers that overlap the argument registers
+  // Bounce them through the stack and pop them in to place
+  for (uint32_t i = Op->NumArgs; i > 0; --i) {
+    push(GetSrc<RA_64>(Op->Header.Args[i - 1].ID()));
+  }
+
+  for (uint32_t i = 0; i < std::min<uint32_t>(Op->NumArgs, ArgRegs.size()); ++i) {
+    pop(ArgRegs[i]);
+  }
+
+  if (Op->NumArgs > ArgRegs.size()) {
+    ArgStackSize += 8;
+  }
+
+  mov(rdi, STATE);
+
+  CallHostFunction(Op->HandlerFnPtr, ArgStackSize);
+
+  PopCallerSaved(SaveState);
 
   mov (GetDst<RA_64>(Node), rax);
 }
 
-DEF_OP(Thunk) {
-  auto Op = IROp->C<IR::IROp_Thunk>();
+DEF_OP(InlineSyscall) {
+  auto Op = IROp->C<IR::IROp_InlineSyscall>();
 
-  auto NumPush = RA64.size();
+  // The kernel only clobbers rcx and r11, XMMs don't need saving
+  auto SaveState = PushCallerSaved(Node, false);
 
-  for (auto &Reg : RA64)
-    push(Reg);
+  // Kernel ABI
+  // Number: rax
+  // Args: rdi, rsi, rdx, r10, r8, r9
+  //
+  // Result: RAX
+  const std::array<Xbyak::Reg, 6> ArgRegs = { rdi, rsi, rdx, r10, r8, r9 };
 
-  if (NumPush & 1)
-    sub(rsp, 8); // Align
+  for (uint32_t i = Op->NumArgs; i > 0; --i) {
+    push(GetSrc<RA_64>(Op->Header.Args[i - 1].ID()));
+  }
 
-  mov(rdi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+  for (uint32_t i = 0; i < Op->NumArgs; ++i) {
+    pop(ArgRegs[i]);
+  }
 
-  mov(rax, reinterpret_cast<uintptr_t>(Op->ThunkFnPtr));
-  call(rax);
+  mov(eax, Op->HostSyscallNumber);
+  syscall();
 
-  if (NumPush & 1)
-    add(rsp, 8); // Align
+  PopCallerSaved(SaveState);
 
-  for (uint32_t i = RA64.size(); i > 0; --i)
-    pop(RA64[i - 1]);
+  mov (GetDst<RA_64>(Node), rax);
 }
 
 DEF_OP(ValidateCode) {
@@ -214,25 +255,51 @@ DEF_OP(ValidateCode) {
   int len = Op->CodeLength;
   int idx = 0;
 
-  xor_(GetDst<RA_64>(Node), GetDst<RA_64>(Node));
+  auto Dst = GetDst<RA_64>(Node);
+  xor_(Dst, Dst);
   mov(rax, Op->CodePtr);
+
+  if (len == 16) {
+    // The frontend hands us the block in 16 byte chunks, compare each in one go
+    movdqu(xmm15, xword[rax]);
+    if (Features.SupportsSSE4_1) {
+      pxor(xmm15, xword[rip + AddLiteral(Op->CodeOriginal)]);
+      ptest(xmm15, xmm15);
+      setnz(Dst.cvt8());
+    }
+    else {
+      pcmpeqb(xmm15, xword[rip + AddLiteral(Op->CodeOriginal)]);
+      pmovmskb(ecx, xmm15);
+      cmp(ecx, 0xFFFF);
+      setne(Dst.cvt8());
+    }
+    return;
+  }
+
   mov(rbx, 1);
+  while (len >= 8) {
+    mov(rcx, *(uint64_t*)(OldCode + idx));
+    cmp(qword[rax + idx], rcx);
+    cmovne(Dst, rbx);
+    len-=8;
+    idx+=8;
+  }
   while (len >= 4) {
     cmp(dword[rax + idx], *(uint32_t*)(OldCode + idx));
-    cmovne(GetDst<RA_64>(Node), rbx);
+    cmovne(Dst, rbx);
     len-=4;
     idx+=4;
   }
   while (len >= 2) {
     mov(rcx, *(uint16_t*)(OldCode + idx));
     cmp(word[rax + idx], cx);
-    cmovne(GetDst<RA_64>(Node), rbx);
+    cmovne(Dst, rbx);
     len-=2;
     idx+=2;
   }
   while (len >= 1) {
     cmp(byte[rax + idx], *(uint8_t*)(OldCode + idx));
-    cmovne(GetDst<RA_64>(Node), rbx);
+    cmovne(Dst, rbx);
     len-=1;
     idx+=1;
   }
@@ -241,27 +308,15 @@ DEF_OP(ValidateCode) {
 DEF_OP(RemoveCodeEntry) {
   auto Op = IROp->C<IR::IROp_RemoveCodeEntry>();
 
-  auto NumPush = RA64.size();
-
-  for (auto &Reg : RA64)
-    push(Reg);
-
-  if (NumPush & 1)
-    sub(rsp, 8); // Align
+  auto SaveState = PushCallerSaved(Node);
 
   mov(rdi, STATE);
   mov(rax, Op->RIP); // imm64 move
   mov(rsi, rax);
 
+  CallHostFunction(reinterpret_cast<uintptr_t>(&Context::Context::RemoveCodeEntry));
 
-  mov(rax, reinterpret_cast<uintptr_t>(&Context::Context::RemoveCodeEntry));
-  call(rax);
-
-  if (NumPush & 1)
-    add(rsp, 8); // Align
-
-  for (uint32_t i = RA64.size(); i > 0; --i)
-    pop(RA64[i - 1]);
+  PopCallerSaved(SaveState);
 }
 
 DEF_OP(CPUID) {
@@ -274,8 +329,7 @@ DEF_OP(CPUID) {
   } Ptr;
   Ptr.ClassPtr = &CPUIDEmu::RunFunction;
 
-  for (auto &Reg : RA64)
-    push(Reg);
+  auto SaveState = PushCallerSaved(Node);
 
   // CPUID ABI
   // this: rdi
@@ -286,22 +340,10 @@ DEF_OP(CPUID) {
   mov (rsi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
   mov (rdi, reinterpret_cast<uint64_t>(&CTX->CPUID));
 
-  auto NumPush = RA64.size();
-
-  if (NumPush & 1)
-    sub(rsp, 8); // Align
-
-  mov(rax, Ptr.Raw);
-
   // {rdi, rsi, rdx}
+  CallHostFunction(Ptr.Raw);
 
-  call(rax);
-
-  if (NumPush & 1)
-    add(rsp, 8); // Align
-
-  for (uint32_t i = RA64.size(); i > 0; --i)
-    pop(RA64[i - 1]);
+  PopCallerSaved(SaveState);
 
   auto Dst = GetSrcPair<RA_64>(Node);
   mov(Dst.first, rax);
@@ -321,6 +363,8 @@ void JITCore::RegisterBranchHandlers() {
   REGISTER_OP(CONDJUMP,          CondJump);
   REGISTER_OP(SYSCALL,           Syscall);
   REGISTER_OP(THUNK,             Thunk);
+  REGISTER_OP(DIRECTSYSCALL,     DirectSyscall);
+  REGISTER_OP(INLINESYSCALL,     InlineSyscall);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(REMOVECODEENTRY,   RemoveCodeEntry);
   REGISTER_OP(CPUID,             CPUID);
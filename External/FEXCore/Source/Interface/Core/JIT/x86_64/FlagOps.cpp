@@ -1,5 +1,6 @@
 #include "Interface/Core/JIT/x86_64/JITClass.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
+#include <FEXCore/Core/X86Enums.h>
 
 namespace FEXCore::CPU {
 
@@ -7,16 +8,58 @@ namespace FEXCore::CPU {
 DEF_OP(GetHostFlag) {
   auto Op = IROp->C<IR::IROp_GetHostFlag>();
 
+  if (Features.SupportsBMI1) {
+    mov(eax, (1 << 8) | Op->Flag);
+    bextr(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), rax);
+    return;
+  }
+
   mov(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
   shr(rax, Op->Flag);
   and(rax, 1);
   mov(GetDst<RA_64>(Node), rax);
 }
 
+DEF_OP(HostFlags) {
+  auto Op = IROp->C<IR::IROp_HostFlags>();
+
+  // Run the guest operation again at its size so the host calculates the flags
+  mov(rcx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+  mov(rdx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+
+  Xbyak::Reg Src1, Src2;
+  switch (Op->SrcSize) {
+    case 1: Src1 = cl;  Src2 = dl;  break;
+    case 2: Src1 = cx;  Src2 = dx;  break;
+    case 4: Src1 = ecx; Src2 = edx; break;
+    case 8: Src1 = rcx; Src2 = rdx; break;
+    default: LogMan::Msg::A("Unknown HostFlags size: %d", Op->SrcSize); break;
+  }
+
+  switch (Op->ALUOp) {
+    case IR::HOSTFLAGS_OP_ADD:   add(Src1, Src2); break;
+    case IR::HOSTFLAGS_OP_SUB:   sub(Src1, Src2); break;
+    case IR::HOSTFLAGS_OP_LOGIC: test(Src1, Src2); break;
+    default: LogMan::Msg::A("Unknown HostFlags op: %d", Op->ALUOp); break;
+  }
+
+  // AH = SF:ZF:0:AF:0:PF:1:CF, which already matches the low byte of RFLAGS
+  lahf();
+  seto(al);
+  movzx(ecx, ah);
+  and(ecx, (1 << X86State::RFLAG_CF_LOC) | (1 << X86State::RFLAG_PF_LOC) | (1 << X86State::RFLAG_AF_LOC) |
+           (1 << X86State::RFLAG_ZF_LOC) | (1 << X86State::RFLAG_SF_LOC));
+  movzx(eax, al);
+  shl(eax, X86State::RFLAG_OF_LOC);
+  or(ecx, eax);
+  mov(GetDst<RA_32>(Node), ecx);
+}
+
 #undef DEF_OP
 void JITCore::RegisterFlagHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &JITCore::Op_##x
   REGISTER_OP(GETHOSTFLAG, GetHostFlag);
+  REGISTER_OP(HOSTFLAGS,   HostFlags);
 #undef REGISTER_OP
 }
 }
@@ -349,11 +349,15 @@ JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadSt
   : CodeGenerator(Buffer.Size, Buffer.Ptr, nullptr)
   , CTX {ctx}
   , ThreadState {Thread}
+  , Features {ctx->HostFeatures}
   , InitialCodeBuffer {Buffer}
+  , IsCompileThread {CompileThread}
 {
   ThreadSharedData.SignalHandlerRefCounterPtr = &SignalHandlerRefCounter;
 
   CurrentCodeBuffer = &InitialCodeBuffer;
+  PublishCodeRange(PUBLISHED_CODE_INITIAL, InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
+  ResetColdCode();
 
   RAPass = Thread->PassManager->GetRAPass();
 
@@ -428,6 +432,7 @@ void JITCore::ClearCache() {
     if (!CodeBuffers.empty()) {
       // If we have more than one code buffer we are tracking then walk them and delete
       // This is a cleanup step
+      PublishCodeRange(PUBLISHED_CODE_CURRENT, nullptr, 0);
       for (auto CodeBuffer : CodeBuffers) {
         FreeCodeBuffer(CodeBuffer);
       }
@@ -443,6 +448,7 @@ void JITCore::ClearCache() {
       reset();
     }
     else {
+      PublishCodeRange(PUBLISHED_CODE_INITIAL, nullptr, 0);
       FreeCodeBuffer(InitialCodeBuffer);
 
       // Resize the code buffer and reallocate our code size
@@ -451,6 +457,7 @@ void JITCore::ClearCache() {
 
       InitialCodeBuffer = AllocateNewCodeBuffer(CurrentCodeBuffer->Size);
       setNewBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
+      PublishCodeRange(PUBLISHED_CODE_INITIAL, InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
     }
   }
   else {
@@ -460,7 +467,69 @@ void JITCore::ClearCache() {
     auto NewCodeBuffer = AllocateNewCodeBuffer(JITCore::INITIAL_CODE_SIZE);
     EmplaceNewCodeBuffer(NewCodeBuffer);
     setNewBuffer(NewCodeBuffer.Ptr, NewCodeBuffer.Size);
+    PublishCodeRange(PUBLISHED_CODE_CURRENT, NewCodeBuffer.Ptr, NewCodeBuffer.Size);
   }
+
+  // The frontend has dropped every block mapping, nothing left to evict
+  for (auto &Blocks : GenerationBlocks) {
+    Blocks.clear();
+  }
+  GenerationLastUse.fill(0);
+  CurrentGeneration = 0;
+  ResetColdCode();
+}
+
+bool JITCore::CanEvictCodeGeneration(size_t BufferRange, size_t ColdBufferRange) const {
+  // Compile threads hand their code to the parent thread, which owns the block mappings
+  // Signal frames could be running code from any generation
+  // A fresh generation only has its hot and cold areas to offer, the block needs to fit in both
+  constexpr size_t ColdSize = GENERATION_SIZE / COLD_CODE_DIVISOR;
+  return !IsCompileThread &&
+    CurrentCodeBuffer == &InitialCodeBuffer &&
+    CurrentCodeBuffer->Size == MAX_CODE_SIZE &&
+    *ThreadSharedData.SignalHandlerRefCounterPtr == 0 &&
+    BufferRange <= (GENERATION_SIZE - ColdSize) &&
+    ColdBufferRange <= ColdSize;
+}
+
+size_t JITCore::GetGenerationStart() const {
+  if (CurrentCodeBuffer == &InitialCodeBuffer && CurrentCodeBuffer->Size == MAX_CODE_SIZE) {
+    return CurrentGeneration * GENERATION_SIZE;
+  }
+  return 0;
+}
+
+size_t JITCore::GetGenerationEnd() const {
+  if (CurrentCodeBuffer == &InitialCodeBuffer && CurrentCodeBuffer->Size == MAX_CODE_SIZE) {
+    return (CurrentGeneration + 1) * GENERATION_SIZE;
+  }
+  return CurrentCodeBuffer->Size;
+}
+
+size_t JITCore::GetColdCodeStart() const {
+  size_t End = GetGenerationEnd();
+  return End - (End - GetGenerationStart()) / COLD_CODE_DIVISOR;
+}
+
+void JITCore::EvictCodeGeneration(uint64_t KeepRIP) {
+  // Recycles the generation the dispatcher last ran a block from the longest time ago
+  // Blocks aren't chained, every block returns to the dispatcher and its lookup hits record the generation's epoch
+  // Ties go to the generation after the current one, which is the oldest when nothing has been run from either
+  size_t Victim = (CurrentGeneration + 1) % CODE_GENERATIONS;
+  for (size_t i = 0; i < CODE_GENERATIONS; ++i) {
+    if (i != CurrentGeneration && GenerationLastUse[i] < GenerationLastUse[Victim]) {
+      Victim = i;
+    }
+  }
+  CurrentGeneration = Victim;
+
+  auto &Blocks = GenerationBlocks[CurrentGeneration];
+  CTX->EvictCodeBlocks(ThreadState, Blocks, KeepRIP);
+  Blocks.clear();
+
+  // Only reached from the dispatcher with no signal frames live, so none of this code can be on the stack
+  setSize(CurrentGeneration * GENERATION_SIZE);
+  ResetColdCode();
 }
 
 uint32_t JITCore::GetPhys(uint32_t Node) {
@@ -583,6 +652,91 @@ bool JITCore::IsInlineConstant(const IR::OrderedNodeWrapper& WNode, uint64_t* Va
   }
 }
 
+JITCore::HostCallSaveState JITCore::PushCallerSaved(uint32_t Node, bool SaveXMMs) {
+  HostCallSaveState State{};
+
+  RAPass->GetLiveAcrossNode(Node, &LiveAcrossCall);
+  for (auto RegAndClass : LiveAcrossCall) {
+    uint32_t Reg = RegAndClass;
+    uint64_t Class = RegAndClass & ~0xFFFF'FFFFULL;
+    if (Class == GPRBase) {
+      State.GPRMask |= 1U << Reg;
+    }
+    else if (Class == XMMBase) {
+      State.XMMMask |= 1U << Reg;
+    }
+    else if (Class == GPRPairBase) {
+      // Pairs are built from consecutive RA64 registers
+      State.GPRMask |= 0b11U << (Reg * 2);
+    }
+  }
+
+  // Callee saved registers survive the call on their own
+  State.GPRMask &= RA64CallerSavedMask;
+  if (!SaveXMMs) {
+    State.XMMMask = 0;
+  }
+
+  uint32_t NumPush = 0;
+  for (uint32_t i = 0; i < RA64.size(); ++i) {
+    if (State.GPRMask & (1U << i)) {
+      push(RA64[i]);
+      ++NumPush;
+    }
+  }
+
+  // rsp is aligned at the start of an op, pad out an odd number of pushes so the XMM area is aligned as well
+  State.StackSize = __builtin_popcount(State.XMMMask) * 16 + ((NumPush & 1) ? 8 : 0);
+  if (State.StackSize) {
+    sub(rsp, State.StackSize);
+  }
+
+  uint32_t Offset = 0;
+  for (uint32_t i = 0; i < RAXMM_x.size(); ++i) {
+    if (State.XMMMask & (1U << i)) {
+      movaps(xword[rsp + Offset], RAXMM_x[i]);
+      Offset += 16;
+    }
+  }
+
+  return State;
+}
+
+void JITCore::PopCallerSaved(HostCallSaveState const &State) {
+  uint32_t Offset = 0;
+  for (uint32_t i = 0; i < RAXMM_x.size(); ++i) {
+    if (State.XMMMask & (1U << i)) {
+      movaps(RAXMM_x[i], xword[rsp + Offset]);
+      Offset += 16;
+    }
+  }
+
+  if (State.StackSize) {
+    add(rsp, State.StackSize);
+  }
+
+  for (uint32_t i = RA64.size(); i > 0; --i) {
+    if (State.GPRMask & (1U << (i - 1))) {
+      pop(RA64[i - 1]);
+    }
+  }
+}
+
+void JITCore::CallHostFunction(uint64_t Function, uint32_t ArgStackSize) {
+  // Arguments are pushed 8 bytes at a time
+  uint32_t Padding = ArgStackSize & 8;
+  if (Padding) {
+    sub(rsp, Padding); // Align
+  }
+
+  mov(rax, Function);
+  call(rax);
+
+  if (ArgStackSize + Padding) {
+    add(rsp, ArgStackSize + Padding);
+  }
+}
+
 std::tuple<JITCore::SetCC, JITCore::CMovCC, JITCore::JCC> JITCore::GetCC(IR::CondClassType cond) {
     switch (cond.Val) {
     case FEXCore::IR::COND_EQ:  return { &CodeGenerator::sete , &CodeGenerator::cmove , &CodeGenerator::je  };
@@ -613,8 +767,205 @@ std::tuple<JITCore::SetCC, JITCore::CMovCC, JITCore::JCC> JITCore::GetCC(IR::Con
   }
 }
 
+/**
+ * @brief Picks the order blocks get emitted in and splits off the cold ones
+ *
+ * IR order interleaves the SMC invalidation blocks, loop exits and fault paths with the hot path.
+ * Static heuristics mark blocks cold:
+ * - Blocks with a RemoveCodeEntry or Break (SMC invalidation, guest faults and traps)
+ * - Exit blocks branched to from a block whose other successor stays in the IR (REP and loop exits)
+ * - Blocks that are only reachable from cold blocks
+ * The hot blocks are then chained so each one is followed by its fall-through successor where possible,
+ * which lets PendingTargetLabel drop the jmp. Cold blocks keep their IR order and go to the cold code region.
+ *
+ * We don't have per IR block profile data, so this is purely static.
+ */
+void JITCore::ComputeBlockLayout() {
+  LayoutBlocks.clear();
+  LayoutBlockIndex.clear();
+  HotBlocks.clear();
+  ColdBlocks.clear();
+  // Space for aligning the literals
+  ColdOpCount = 1;
+
+  for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
+    LayoutBlockIndex[IR->GetID(BlockNode)] = LayoutBlocks.size();
+    LayoutBlocks.emplace_back(LayoutBlockInfo{BlockNode, NO_LAYOUT_BLOCK, NO_LAYOUT_BLOCK});
+  }
+
+  for (auto &Block : LayoutBlocks) {
+    for (auto [CodeNode, IROp] : IR->GetCode(Block.Node)) {
+      ++Block.NumOps;
+
+      switch (IROp->Op) {
+        case IR::OP_JUMP:
+          Block.FallThrough = LayoutBlockIndex[IROp->Args[0].ID()];
+          break;
+        case IR::OP_CONDJUMP: {
+          auto Op = IROp->C<IR::IROp_CondJump>();
+          Block.Taken = LayoutBlockIndex[Op->TrueBlock.ID()];
+          Block.FallThrough = LayoutBlockIndex[Op->FalseBlock.ID()];
+          break;
+        }
+        case IR::OP_REMOVECODEENTRY:
+        case IR::OP_BREAK:
+          Block.Cold = true;
+          break;
+        case IR::OP_VALIDATECODE:
+          // Leaves a literal in the cold code region
+          ++ColdOpCount;
+          break;
+        default: break;
+      }
+    }
+
+    Block.Exits = Block.FallThrough == NO_LAYOUT_BLOCK;
+  }
+
+  // Side exits
+  for (auto &Block : LayoutBlocks) {
+    if (Block.Taken == NO_LAYOUT_BLOCK) {
+      continue;
+    }
+
+    auto &Taken = LayoutBlocks[Block.Taken];
+    auto &FallThrough = LayoutBlocks[Block.FallThrough];
+    if (Taken.Exits != FallThrough.Exits) {
+      (Taken.Exits ? Taken : FallThrough).Cold = true;
+    }
+  }
+
+  // The entry has to be the first thing emitted
+  LayoutBlocks[0].Cold = false;
+
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+
+    for (auto &Block : LayoutBlocks) {
+      Block.HotPredecessors = 0;
+    }
+
+    for (auto &Block : LayoutBlocks) {
+      if (Block.Cold) {
+        continue;
+      }
+      if (Block.FallThrough != NO_LAYOUT_BLOCK) {
+        ++LayoutBlocks[Block.FallThrough].HotPredecessors;
+      }
+      if (Block.Taken != NO_LAYOUT_BLOCK) {
+        ++LayoutBlocks[Block.Taken].HotPredecessors;
+      }
+    }
+
+    for (size_t i = 1; i < LayoutBlocks.size(); ++i) {
+      auto &Block = LayoutBlocks[i];
+      if (!Block.Cold && !Block.HotPredecessors) {
+        Block.Cold = true;
+        Changed = true;
+      }
+    }
+  }
+
+  // Chain the hot blocks along their fall-through edges, falling back to IR order
+  size_t NextInOrder = 1;
+  uint32_t Current = 0;
+  while (Current != NO_LAYOUT_BLOCK) {
+    auto &Block = LayoutBlocks[Current];
+    Block.Placed = true;
+    HotBlocks.emplace_back(Block.Node);
+
+    Current = Block.FallThrough;
+    if (Current == NO_LAYOUT_BLOCK ||
+        LayoutBlocks[Current].Cold ||
+        LayoutBlocks[Current].Placed) {
+      Current = NO_LAYOUT_BLOCK;
+      for (; NextInOrder < LayoutBlocks.size(); ++NextInOrder) {
+        if (!LayoutBlocks[NextInOrder].Cold && !LayoutBlocks[NextInOrder].Placed) {
+          Current = NextInOrder;
+          break;
+        }
+      }
+    }
+  }
+
+  for (auto &Block : LayoutBlocks) {
+    if (Block.Cold) {
+      ColdBlocks.emplace_back(Block.Node);
+      ColdOpCount += Block.NumOps;
+    }
+  }
+}
+
+void JITCore::EmitBlock(IR::OrderedNode *BlockNode) {
+  using namespace FEXCore::IR;
+  {
+    auto BlockIROp = IR->GetOp<IROp_CodeBlock>(BlockNode);
+    LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+
+    uint32_t Node = IR->GetID(BlockNode);
+    auto IsTarget = JumpTargets.find(Node);
+    if (IsTarget == JumpTargets.end()) {
+      IsTarget = JumpTargets.try_emplace(Node).first;
+    }
+
+    // if there is a pending branch, and it is not fall-through
+    if (PendingTargetLabel && PendingTargetLabel != &IsTarget->second)
+    {
+      jmp(*PendingTargetLabel, T_NEAR);
+    }
+    PendingTargetLabel = nullptr;
+
+    L(IsTarget->second);
+  }
+
+  for (auto [CodeNode, IROp] : IR->GetCode(BlockNode)) {
+    #ifdef DEBUG_RA
+    if (IROp->Op != IR::OP_BEGINBLOCK &&
+        IROp->Op != IR::OP_CONDJUMP &&
+        IROp->Op != IR::OP_JUMP) {
+      std::stringstream Inst;
+      auto Name = FEXCore::IR::GetName(IROp->Op);
+
+      if (IROp->HasDest) {
+        uint64_t PhysReg = RAPass->GetNodeRegister(Node);
+        if (PhysReg >= GPRPairBase)
+          Inst << "\tPair" << GetPhys(Node) << " = " << Name << " ";
+        else if (PhysReg >= XMMBase)
+          Inst << "\tXMM" << GetPhys(Node) << " = " << Name << " ";
+        else
+          Inst << "\tReg" << GetPhys(Node) << " = " << Name << " ";
+      }
+      else {
+        Inst << "\t" << Name << " ";
+      }
+
+      uint8_t NumArgs = IR::GetArgs(IROp->Op);
+      for (uint8_t i = 0; i < NumArgs; ++i) {
+        uint32_t ArgNode = IROp->Args[i].ID();
+        uint64_t PhysReg = RAPass->GetNodeRegister(ArgNode);
+        if (PhysReg >= GPRPairBase)
+          Inst << "Pair" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
+        else if (PhysReg >= XMMBase)
+          Inst << "XMM" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
+        else
+          Inst << "Reg" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
+      }
+
+      LogMan::Msg::D("%s", Inst.str().c_str());
+    }
+    #endif
+    uint32_t ID = IR->GetID(CodeNode);
+
+    // Execute handler
+    OpHandler Handler = OpHandlers[IROp->Op];
+    (this->*Handler)(IROp, ID);
+  }
+}
+
 void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
   JumpTargets.clear();
+  PendingLiterals.clear();
   uint32_t SSACount = IR->GetSSACount();
 
   auto HeaderOp = IR->GetHeader();
@@ -622,135 +973,45 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
     return ThreadSharedData.InterpreterFallbackHelperAddress;
   }
 
+  this->IR = IR;
+  ComputeBlockLayout();
+
   // Fairly excessive buffer range to make sure we don't overflow
   uint32_t BufferRange = SSACount * 16;
-  if ((getSize() + BufferRange) > CurrentCodeBuffer->Size) {
-    ThreadState->CTX->ClearCodeCache(ThreadState, HeaderOp->Entry);
+  uint32_t ColdBufferRange = ColdOpCount * 16;
+  if ((getSize() + BufferRange) > GetColdCodeStart() ||
+      (ColdCodeCursor + ColdBufferRange) > GetGenerationEnd()) {
+    if (CanEvictCodeGeneration(BufferRange, ColdBufferRange)) {
+      EvictCodeGeneration(HeaderOp->Entry);
+    }
+    else {
+      ThreadState->CTX->ClearCodeCache(ThreadState, HeaderOp->Entry);
+    }
   }
 
 	void *Entry = getCurr<void*>();
-  this->IR = IR;
 
   LogMan::Throw::A(RAPass->HasFullRA(), "Needs RA");
 
   SpillSlots = RAPass->SpillSlots();
 
   if (SpillSlots) {
-    sub(rsp, SpillSlots * 16 + 8);
+    sub(rsp, SpillSlots * 8 + 8);
   }
   else {
     sub(rsp, 8);
   }
 
-#ifdef BLOCKSTATS
-  BlockSamplingData::BlockData *SamplingData = CTX->BlockData->GetBlockData(HeaderOp->Entry);
-  if (GetSamplingData) {
-    mov(rcx, reinterpret_cast<uintptr_t>(SamplingData));
-    rdtsc();
-    shl(rdx, 32);
-    or(rax, rdx);
-    mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Start)], rax);
+  if (DebugData && DebugData->ProfileIndex != BlockSamplingData::NO_PROFILE_INDEX) {
+    // Block profiling, one increment per entry in to this thread's dense counter array
+    mov(rcx, qword [STATE + offsetof(FEXCore::Core::InternalThreadState, BlockCounters)]);
+    inc(qword [rcx + DebugData->ProfileIndex * sizeof(uint64_t)]);
   }
 
-  auto ExitBlock = [&]() {
-    if (GetSamplingData) {
-      mov(rcx, reinterpret_cast<uintptr_t>(SamplingData));
-      // Get time
-      rdtsc();
-      shl(rdx, 32);
-      or(rax, rdx);
-
-      // Calculate time spent in block
-      mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Start)]);
-      sub(rax, rdx);
-
-      // Add time to total time
-      add(qword [rcx + offsetof(BlockSamplingData::BlockData, TotalTime)], rax);
-
-      // Increment call count
-      inc(qword [rcx + offsetof(BlockSamplingData::BlockData, TotalCalls)]);
-
-      // Calculate min
-      mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Min)]);
-      cmp(rdx, rax);
-      cmova(rdx, rax);
-      mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Min)], rdx);
-
-      // Calculate max
-      mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Max)]);
-      cmp(rdx, rax);
-      cmovb(rdx, rax);
-      mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Max)], rdx);
-    }
-  };
-#endif
-
   PendingTargetLabel = nullptr;
 
-  for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
-    using namespace FEXCore::IR;
-    {
-      auto BlockIROp = BlockHeader->CW<IROp_CodeBlock>();
-      LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
-
-      uint32_t Node = IR->GetID(BlockNode);
-      auto IsTarget = JumpTargets.find(Node);
-      if (IsTarget == JumpTargets.end()) {
-        IsTarget = JumpTargets.try_emplace(Node).first;
-      }
-
-      // if there is a pending branch, and it is not fall-through
-      if (PendingTargetLabel && PendingTargetLabel != &IsTarget->second)
-      {
-        jmp(*PendingTargetLabel, T_NEAR);
-      }
-      PendingTargetLabel = nullptr;
-
-      L(IsTarget->second);
-    }
-
-    for (auto [CodeNode, IROp] : IR->GetCode(BlockNode)) {
-      #ifdef DEBUG_RA
-      if (IROp->Op != IR::OP_BEGINBLOCK &&
-          IROp->Op != IR::OP_CONDJUMP &&
-          IROp->Op != IR::OP_JUMP) {
-        std::stringstream Inst;
-        auto Name = FEXCore::IR::GetName(IROp->Op);
-
-        if (IROp->HasDest) {
-          uint64_t PhysReg = RAPass->GetNodeRegister(Node);
-          if (PhysReg >= GPRPairBase)
-            Inst << "\tPair" << GetPhys(Node) << " = " << Name << " ";
-          else if (PhysReg >= XMMBase)
-            Inst << "\tXMM" << GetPhys(Node) << " = " << Name << " ";
-          else
-            Inst << "\tReg" << GetPhys(Node) << " = " << Name << " ";
-        }
-        else {
-          Inst << "\t" << Name << " ";
-        }
-
-        uint8_t NumArgs = IR::GetArgs(IROp->Op);
-        for (uint8_t i = 0; i < NumArgs; ++i) {
-          uint32_t ArgNode = IROp->Args[i].ID();
-          uint64_t PhysReg = RAPass->GetNodeRegister(ArgNode);
-          if (PhysReg >= GPRPairBase)
-            Inst << "Pair" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
-          else if (PhysReg >= XMMBase)
-            Inst << "XMM" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
-          else
-            Inst << "Reg" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
-        }
-
-        LogMan::Msg::D("%s", Inst.str().c_str());
-      }
-      #endif
-      uint32_t ID = IR->GetID(CodeNode);
-
-      // Execute handler
-      OpHandler Handler = OpHandlers[IROp->Op];
-      (this->*Handler)(IROp, ID);
-    }
+  for (auto BlockNode : HotBlocks) {
+    EmitBlock(BlockNode);
   }
 
   // Make sure last branch is generated. It certainly can't be eliminated here.
@@ -762,6 +1023,35 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
   void *Exit = getCurr<void*>();
 
+  if (!ColdBlocks.empty() || !PendingLiterals.empty()) {
+    // Labels are offsets in to the same buffer, so branches between the two regions resolve like any other
+    size_t HotEnd = getSize();
+    setSize(ColdCodeCursor);
+
+    for (auto BlockNode : ColdBlocks) {
+      EmitBlock(BlockNode);
+    }
+
+    if (PendingTargetLabel)
+    {
+      jmp(*PendingTargetLabel, T_NEAR);
+    }
+    PendingTargetLabel = nullptr;
+
+    if (!PendingLiterals.empty()) {
+      align(16);
+      for (auto &[Literal, Value] : PendingLiterals) {
+        L(Literal);
+        dq(static_cast<uint64_t>(Value));
+        dq(static_cast<uint64_t>(Value >> 64));
+      }
+      PendingLiterals.clear();
+    }
+
+    ColdCodeCursor = getSize();
+    setSize(HotEnd);
+  }
+
   this->IR = nullptr;
 
   ready();
@@ -769,6 +1059,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
   if (DebugData) {
     DebugData->HostCodeSize = reinterpret_cast<uintptr_t>(Exit) - reinterpret_cast<uintptr_t>(Entry);
   }
+
+  if (!IsCompileThread) {
+    GenerationBlocks[CurrentGeneration].emplace_back(HeaderOp->Entry, reinterpret_cast<uintptr_t>(Entry));
+    // Compiling is what moves the epoch on, a generation being filled counts as used
+    GenerationLastUse[CurrentGeneration] = ++GenerationEpoch;
+  }
   return Entry;
 }
 
@@ -787,6 +1083,7 @@ static void SleepThread(FEXCore::Context::Context *ctx, FEXCore::Core::InternalT
 void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   DispatcherCodeBuffer = AllocateNewCodeBuffer(MAX_DISPATCHER_CODE_SIZE);
   setNewBuffer(DispatcherCodeBuffer.Ptr, DispatcherCodeBuffer.Size);
+  PublishCodeRange(PUBLISHED_CODE_DISPATCHER, DispatcherCodeBuffer.Ptr, DispatcherCodeBuffer.Size);
 
 // Temp registers
 // rax, rcx, rdx, rsi, r8, r9,
@@ -837,6 +1134,7 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
 
   Label LoopTop;
   Label NoBlock;
+  Label SkipGenerationUse;
   Label ThreadPauseHandler{};
 
   L(LoopTop);
@@ -876,6 +1174,21 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     je(NoBlock);
 
     // Real block if we made it here
+    // Record the current epoch against the block's code generation for eviction
+    // Blocks outside of the initial buffer land out of range, which is fine since only its generations get evicted
+    mov(rcx, reinterpret_cast<uint64_t>(&InitialCodeBuffer.Ptr));
+    mov(rdx, rax);
+    sub(rdx, qword [rcx]);
+    shr(rdx, (int)log2(GENERATION_SIZE));
+    cmp(rdx, CODE_GENERATIONS);
+    jae(SkipGenerationUse);
+
+    mov(rcx, reinterpret_cast<uint64_t>(&GenerationEpoch));
+    mov(rcx, qword [rcx]);
+    mov(rsi, reinterpret_cast<uint64_t>(GenerationLastUse.data()));
+    mov(qword [rsi + rdx * 8], rcx);
+    L(SkipGenerationUse);
+
     call(rax);
 
     if (CTX->GetGdbServerStatus()) {
@@ -1022,6 +1335,7 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   ready();
 
   setNewBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
+  ResetColdCode();
 }
 
 FEXCore::CPU::CPUBackend *CreateJITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread) {
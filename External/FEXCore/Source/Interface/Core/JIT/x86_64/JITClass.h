@@ -15,7 +15,10 @@ using namespace Xbyak;
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+#include <array>
+#include <deque>
 #include <tuple>
+#include <vector>
 
 namespace FEXCore::CPU {
 struct CodeBuffer {
@@ -76,12 +79,40 @@ public:
 
 private:
   Label* PendingTargetLabel{};
+
+  struct LayoutBlockInfo {
+    IR::OrderedNode *Node;
+    uint32_t FallThrough; ///< Jump target or CondJump false block
+    uint32_t Taken;       ///< CondJump true block
+    uint32_t NumOps;
+    uint32_t HotPredecessors;
+    bool Exits;
+    bool Cold;
+    bool Placed;
+  };
+
+  static constexpr uint32_t NO_LAYOUT_BLOCK = ~0U;
+  std::vector<LayoutBlockInfo> LayoutBlocks;
+  std::unordered_map<IR::OrderedNodeWrapper::NodeOffsetType, uint32_t> LayoutBlockIndex;
+  // Emission order of the current IR, cold blocks go in to the cold code region
+  std::vector<IR::OrderedNode*> HotBlocks;
+  std::vector<IR::OrderedNode*> ColdBlocks;
+  uint32_t ColdOpCount{};
+
+  void ComputeBlockLayout();
+  void EmitBlock(IR::OrderedNode *BlockNode);
+
+  // 16 byte constants, emitted after the cold blocks and addressed rip relative
+  std::deque<std::pair<Label, __uint128_t>> PendingLiterals;
+  Label &AddLiteral(__uint128_t Value) {
+    return PendingLiterals.emplace_back(Label{}, Value).first;
+  }
   FEXCore::Context::Context *CTX;
   FEXCore::Core::InternalThreadState *ThreadState;
   FEXCore::IR::IRListView<true> const *IR;
 
   std::unordered_map<IR::OrderedNodeWrapper::NodeOffsetType, Label> JumpTargets;
-  Xbyak::util::Cpu Features{};
+  FEXCore::HostFeatures const &Features;
 
   bool MemoryDebug = false;
 
@@ -98,6 +129,37 @@ private:
   constexpr static uint64_t XMMBase = (1ULL << 32);
   constexpr static uint64_t GPRPairBase = (2ULL << 32);
 
+  // rsi, r8, r9, r10, r11 are the only RA64 registers the SysV ABI lets a callee clobber
+  constexpr static uint32_t RA64CallerSavedMask = 0b1'1111;
+
+  /**  @} */
+
+  /**
+   * @name Host calls
+   * @{ */
+  struct HostCallSaveState {
+    uint32_t GPRMask;   ///< Bits index in to RA64
+    uint32_t XMMMask;   ///< Bits index in to RAXMM_x
+    uint32_t StackSize; ///< XMM save area and alignment padding below the GPR pushes
+  };
+
+  /**
+   * @brief Saves the caller saved registers holding values that are live across Node
+   *
+   * Leaves rsp 16 byte aligned so arguments can be pushed on top before CallHostFunction
+   * @param SaveXMMs False when the call can't touch vector registers, like a raw host syscall
+   */
+  HostCallSaveState PushCallerSaved(uint32_t Node, bool SaveXMMs = true);
+  void PopCallerSaved(HostCallSaveState const &State);
+
+  /**
+   * @brief Calls a host function with the stack aligned
+   *
+   * @param ArgStackSize How much the caller pushed after PushCallerSaved, released after the call
+   */
+  void CallHostFunction(uint64_t Function, uint32_t ArgStackSize = 0);
+
+  std::vector<uint64_t> LiveAcrossCall;
   /**  @} */
 
   constexpr static uint8_t RA_8 = 0;
@@ -129,10 +191,6 @@ private:
   void CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread);
   IR::RegisterAllocationPass *RAPass;
 
-#ifdef BLOCKSTATS
-  bool GetSamplingData {true};
-#endif
-
   static constexpr size_t MAX_DISPATCHER_CODE_SIZE = 4096 * 1;
 
   void EmplaceNewCodeBuffer(CodeBuffer Buffer) {
@@ -153,6 +211,30 @@ private:
   // This is the current code buffer that we are tracking
   CodeBuffer *CurrentCodeBuffer{};
 
+  // Once the initial code buffer has grown to MAX_CODE_SIZE it is split in to generations
+  // Running out of space recycles the oldest generation instead of flushing everything
+  static constexpr size_t CODE_GENERATIONS = 4;
+  static constexpr size_t GENERATION_SIZE = MAX_CODE_SIZE / CODE_GENERATIONS;
+  // Guest RIP and host entry of every block emitted in to each generation
+  std::array<std::vector<std::pair<uint64_t, uintptr_t>>, CODE_GENERATIONS> GenerationBlocks;
+  // Epoch each generation last had a block compiled in to it or run from the dispatcher, the oldest is evicted
+  // The epoch advances per compiled block, the dispatcher's asm stores it on every lookup hit
+  std::array<uint64_t, CODE_GENERATIONS> GenerationLastUse{};
+  uint64_t GenerationEpoch{};
+  size_t CurrentGeneration{};
+  bool IsCompileThread{};
+
+  bool CanEvictCodeGeneration(size_t BufferRange, size_t ColdBufferRange) const;
+  size_t GetGenerationStart() const;
+  size_t GetGenerationEnd() const;
+  void EvictCodeGeneration(uint64_t KeepRIP);
+
+  // The tail of the buffer (or generation) is kept for cold blocks so they don't dilute the hot path
+  static constexpr size_t COLD_CODE_DIVISOR = 8;
+  size_t ColdCodeCursor{};
+  size_t GetColdCodeStart() const;
+  void ResetColdCode() { ColdCodeCursor = GetColdCodeStart(); }
+
   uint64_t AbsoluteLoopTopAddress{};
   uint64_t ThreadStopHandlerAddress{};
   uint64_t ThreadPauseHandlerAddress{};
@@ -276,6 +358,8 @@ private:
   DEF_OP(CondJump);
   DEF_OP(Syscall);
   DEF_OP(Thunk);
+  DEF_OP(DirectSyscall);
+  DEF_OP(InlineSyscall);
   DEF_OP(ValidateCode);
   DEF_OP(RemoveCodeEntry);
   DEF_OP(CPUID);
@@ -296,6 +380,7 @@ private:
 
   ///< Flag ops
   DEF_OP(GetHostFlag);
+  DEF_OP(HostFlags);
 
   ///< Memory ops
   DEF_OP(LoadContextPair);
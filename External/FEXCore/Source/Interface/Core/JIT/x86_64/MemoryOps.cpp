@@ -31,13 +31,13 @@ DEF_OP(StoreContextPair) {
     case 4: {
       auto Src = GetSrcPair<RA_32>(Op->Header.Args[0].ID());
       mov(dword [STATE + Op->Offset], Src.first);
-      mov(dword [STATE + Op->Offset + Op->Size], Src.first);
+      mov(dword [STATE + Op->Offset + Op->Size], Src.second);
       break;
     }
     case 8: {
       auto Src = GetSrcPair<RA_64>(Op->Header.Args[0].ID());
       mov(qword [STATE + Op->Offset], Src.first);
-      mov(qword [STATE + Op->Offset + Op->Size], Src.first);
+      mov(qword [STATE + Op->Offset + Op->Size], Src.second);
       break;
     }
   }
@@ -351,7 +351,7 @@ DEF_OP(SpillRegister) {
   auto Op = IROp->C<IR::IROp_SpillRegister>();
   uint8_t OpSize = IROp->Size;
 
-  uint32_t SlotOffset = Op->Slot * 16;
+  uint32_t SlotOffset = Op->Slot * 8;
   if (Op->Class == FEXCore::IR::GPRClass) {
     switch (OpSize) {
       case 1: {
@@ -399,7 +399,7 @@ DEF_OP(FillRegister) {
   auto Op = IROp->C<IR::IROp_FillRegister>();
   uint8_t OpSize = IROp->Size;
 
-  uint32_t SlotOffset = Op->Slot * 16;
+  uint32_t SlotOffset = Op->Slot * 8;
   if (Op->Class == FEXCore::IR::GPRClass) {
     switch (OpSize) {
       case 1: {
@@ -46,7 +46,7 @@ DEF_OP(Break) {
       if (CTX->GetGdbServerStatus()) {
         // Adjust the stack first for a regular return
         if (SpillSlots) {
-          add(rsp, SpillSlots * 16 + 8);
+          add(rsp, SpillSlots * 8 + 8);
         }
         else {
           add(rsp, 8);
@@ -107,24 +107,13 @@ DEF_OP(SetRoundingMode) {
 DEF_OP(Print) {
   auto Op = IROp->C<IR::IROp_Print>();
 
-  for (auto &Reg : RA64)
-    push(Reg);
-
-  auto NumPush = RA64.size();
-  if (NumPush & 1)
-    sub(rsp, 8); // Align
+  auto SaveState = PushCallerSaved(Node);
 
   mov (rdi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
 
-  mov(rax, reinterpret_cast<uintptr_t>(PrintValue));
-
-  call(rax);
-
-  if (NumPush & 1)
-    add(rsp, 8); // Align
+  CallHostFunction(reinterpret_cast<uintptr_t>(PrintValue));
 
-  for (uint32_t i = RA64.size(); i > 0; --i)
-    pop(RA64[i - 1]);
+  PopCallerSaved(SaveState);
 }
 
 #undef DEF_OP
@@ -143,6 +132,8 @@ void JITCore::RegisterMiscHandlers() {
   REGISTER_OP(GETROUNDINGMODE, GetRoundingMode);
   REGISTER_OP(SETROUNDINGMODE, SetRoundingMode);
   REGISTER_OP(INVALIDATEFLAGS,   NoOp);
+  // x87 state only matters to the interpreter, it syncs the FCW from the context on block entry
+  REGISTER_OP(F80LOADFCW,        NoOp);
 #undef REGISTER_OP
 }
 }
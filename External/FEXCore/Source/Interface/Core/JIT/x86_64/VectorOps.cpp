@@ -80,8 +80,16 @@ DEF_OP(SplatVector) {
 
   switch (ElementSize) {
     case 4:
-      movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
-      shufps(GetDst(Node), GetDst(Node), 0);
+      if (Features.SupportsAVX2) {
+        vbroadcastss(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+      }
+      else if (Features.SupportsAVX) {
+        vshufps(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[0].ID()), 0);
+      }
+      else {
+        movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+        shufps(GetDst(Node), GetDst(Node), 0);
+      }
     break;
     case 8:
       movddup(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
@@ -1382,6 +1390,25 @@ DEF_OP(VSRI) {
 
 DEF_OP(VUShrI) {
   auto Op = IROp->C<IR::IROp_VUShrI>();
+  if (Features.SupportsAVX) {
+    switch (Op->Header.ElementSize) {
+      case 2: {
+        vpsrlw(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      case 4: {
+        vpsrld(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      case 8: {
+        vpsrlq(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    return;
+  }
+
   movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
   switch (Op->Header.ElementSize) {
     case 2: {
@@ -1402,6 +1429,21 @@ DEF_OP(VUShrI) {
 
 DEF_OP(VSShrI) {
   auto Op = IROp->C<IR::IROp_VSShrI>();
+  if (Features.SupportsAVX) {
+    switch (Op->Header.ElementSize) {
+      case 2: {
+        vpsraw(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      case 4: {
+        vpsrad(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    return;
+  }
+
   movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
   switch (Op->Header.ElementSize) {
     case 2: {
@@ -1418,6 +1460,25 @@ DEF_OP(VSShrI) {
 
 DEF_OP(VShlI) {
   auto Op = IROp->C<IR::IROp_VShlI>();
+  if (Features.SupportsAVX) {
+    switch (Op->Header.ElementSize) {
+      case 2: {
+        vpsllw(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      case 4: {
+        vpslld(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      case 8: {
+        vpsllq(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    return;
+  }
+
   movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
   switch (Op->Header.ElementSize) {
     case 2: {
@@ -5035,7 +5035,45 @@ void OpDispatchBuilder::GenerateFlags_SBB(FEXCore::X86Tables::DecodedOp Op, Orde
   }
 }
 
+void OpDispatchBuilder::GenerateFlags_Host(FEXCore::X86Tables::DecodedOp Op, uint8_t ALUOp, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
+  auto Flags = _HostFlags(Src1, Src2, ALUOp, GetSrcSize(Op));
+
+  // Logical ops define AF as zero on our side and always clear CF/OF
+  if (ALUOp == FEXCore::IR::HOSTFLAGS_OP_LOGIC) {
+    SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Constant(0));
+  }
+  else {
+    SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Bfe(1, FEXCore::X86State::RFLAG_AF_LOC, Flags));
+  }
+
+  SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(_Bfe(1, FEXCore::X86State::RFLAG_SF_LOC, Flags));
+
+  if (!CTX->Config.ABINoPF) {
+    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(_Bfe(1, FEXCore::X86State::RFLAG_PF_LOC, Flags));
+  } else {
+    _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
+  }
+
+  SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(_Bfe(1, FEXCore::X86State::RFLAG_ZF_LOC, Flags));
+
+  if (ALUOp == FEXCore::IR::HOSTFLAGS_OP_LOGIC) {
+    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(_Constant(0));
+    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(_Constant(0));
+  }
+  else {
+    if (UpdateCF) {
+      SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(_Bfe(1, FEXCore::X86State::RFLAG_CF_LOC, Flags));
+    }
+    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(_Bfe(1, FEXCore::X86State::RFLAG_OF_LOC, Flags));
+  }
+}
+
 void OpDispatchBuilder::GenerateFlags_SUB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
+  if (HostFlagsMatchGuest) {
+    GenerateFlags_Host(Op, FEXCore::IR::HOSTFLAGS_OP_SUB, Src1, Src2, UpdateCF);
+    return;
+  }
+
   // AF
   {
     OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
@@ -5093,6 +5131,11 @@ void OpDispatchBuilder::GenerateFlags_SUB(FEXCore::X86Tables::DecodedOp Op, Orde
 }
 
 void OpDispatchBuilder::GenerateFlags_ADD(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
+  if (HostFlagsMatchGuest) {
+    GenerateFlags_Host(Op, FEXCore::IR::HOSTFLAGS_OP_ADD, Src1, Src2, UpdateCF);
+    return;
+  }
+
   // AF
   {
     OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
@@ -5205,6 +5248,12 @@ void OpDispatchBuilder::GenerateFlags_UMUL(FEXCore::X86Tables::DecodedOp Op, Ord
 }
 
 void OpDispatchBuilder::GenerateFlags_Logical(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
+  if (HostFlagsMatchGuest) {
+    // Flags only depend on the result, which is its own AND
+    GenerateFlags_Host(Op, FEXCore::IR::HOSTFLAGS_OP_LOGIC, Res, Res, false);
+    return;
+  }
+
   // AF
   {
     // Undefined
@@ -6325,6 +6374,15 @@ void OpDispatchBuilder::SetX87Top(OrderedNode *Value) {
   _StoreContext(GPRClass, 1, offsetof(FEXCore::Core::CPUState, flags) + FEXCore::X86State::X87FLAG_TOP_LOC, Value);
 }
 
+OrderedNode *OpDispatchBuilder::GetX87FCW() {
+  return _LoadContext(2, offsetof(FEXCore::Core::CPUState, FCW), GPRClass);
+}
+
+void OpDispatchBuilder::SetX87FCW(OrderedNode *Value) {
+  _StoreContext(GPRClass, 2, offsetof(FEXCore::Core::CPUState, FCW), Value);
+  _F80LoadFCW(Value);
+}
+
 template<size_t width>
 void OpDispatchBuilder::FLD(OpcodeArgs) {
   Current_Header->ShouldInterpret = true;
@@ -7012,6 +7070,8 @@ void OpDispatchBuilder::X87LDENV(OpcodeArgs) {
   auto Size = GetSrcSize(Op);
   OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
 
+  SetX87FCW(_LoadMem(GPRClass, 2, Mem, 2));
+
   OrderedNode *MemLocation = _Add(Mem, _Constant(Size * 1));
   auto NewFSW = _LoadMem(GPRClass, Size, MemLocation, Size);
 
@@ -7055,8 +7115,8 @@ void OpDispatchBuilder::X87FNSTENV(OpcodeArgs) {
   OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Dest, Op->Flags, -1, false);
 
 	{
-		// FCW store default
-		_StoreMem(GPRClass, Size, Mem, _Constant(0x37F), Size);
+		// FCW
+		_StoreMem(GPRClass, Size, Mem, GetX87FCW(), Size);
 	}
 
 	{
@@ -7111,8 +7171,14 @@ void OpDispatchBuilder::X87FNSTENV(OpcodeArgs) {
 	}
 }
 
+void OpDispatchBuilder::X87FLDCW(OpcodeArgs) {
+  Current_Header->ShouldInterpret = true;
+  OrderedNode *NewFCW = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
+  SetX87FCW(NewFCW);
+}
+
 void OpDispatchBuilder::X87FSTCW(OpcodeArgs) {
-  StoreResult(GPRClass, Op, _Constant(0x37F), -1);
+  StoreResult(GPRClass, Op, GetX87FCW(), -1);
 }
 
 void OpDispatchBuilder::X87LDSW(OpcodeArgs) {
@@ -7179,8 +7245,8 @@ void OpDispatchBuilder::X87FNSAVE(OpcodeArgs) {
 
   OrderedNode *Top = GetX87Top();
 	{
-		// FCW store default
-		_StoreMem(GPRClass, Size, Mem, _Constant(0x37F), Size);
+		// FCW
+		_StoreMem(GPRClass, Size, Mem, GetX87FCW(), Size);
 	}
 
 	{
@@ -7260,6 +7326,8 @@ void OpDispatchBuilder::X87FRSTOR(OpcodeArgs) {
   auto Size = GetSrcSize(Op);
   OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
 
+  SetX87FCW(_LoadMem(GPRClass, 2, Mem, 2));
+
   OrderedNode *MemLocation = _Add(Mem, _Constant(Size * 1));
   auto NewFSW = _LoadMem(GPRClass, Size, MemLocation, Size);
 
@@ -7439,8 +7507,8 @@ void OpDispatchBuilder::FXSaveOp(OpcodeArgs) {
   }
 
   {
-    // FCW store default
-    _StoreMem(GPRClass, 2, Mem, _Constant(0x37F), 2);
+    // FCW
+    _StoreMem(GPRClass, 2, Mem, GetX87FCW(), 2);
   }
 
   {
@@ -7522,6 +7590,8 @@ void OpDispatchBuilder::FXSaveOp(OpcodeArgs) {
 
 void OpDispatchBuilder::FXRStoreOp(OpcodeArgs) {
   OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
+
+  SetX87FCW(_LoadMem(GPRClass, 2, Mem, 2));
   {
     OrderedNode *MemLocation = _Add(Mem, _Constant(2));
     auto NewFSW = _LoadMem(GPRClass, 2, MemLocation, 2);
@@ -8864,7 +8934,7 @@ constexpr uint16_t PF_F2 = 3;
 
     {OPDReg(0xD9, 4) | 0x00, 8, &OpDispatchBuilder::X87LDENV},
 
-    {OPDReg(0xD9, 5) | 0x00, 8, &OpDispatchBuilder::NOPOp}, // XXX: stubbed FLDCW
+    {OPDReg(0xD9, 5) | 0x00, 8, &OpDispatchBuilder::X87FLDCW},
 
     {OPDReg(0xD9, 6) | 0x00, 8, &OpDispatchBuilder::X87FNSTENV},
 
@@ -70,6 +70,11 @@ public:
     flagsOp = FLAGS_OP_NONE;
   }
 
+  /**
+   * @brief Whether the instruction being dispatched has already ended the code block by setting RIP
+   */
+  bool HasSetRIP() const { return BlockSetRIP; }
+
   bool FinishOp(uint64_t NextRIP, bool LastOp) {
     // If we are switching to a new block and this current block has yet to set a RIP
     // Then we need to insert an unconditional jump from the current block to the one we are going to
@@ -383,6 +388,7 @@ public:
   void X87ATAN(OpcodeArgs);
   void X87LDENV(OpcodeArgs);
   void X87FNSTENV(OpcodeArgs);
+  void X87FLDCW(OpcodeArgs);
   void X87FSTCW(OpcodeArgs);
   void X87LDSW(OpcodeArgs);
   void X87FNSTSW(OpcodeArgs);
@@ -496,6 +502,14 @@ private:
 
   OrderedNode *SelectCC(uint8_t OP, OrderedNode *TrueValue, OrderedNode *FalseValue);
 
+#ifdef _M_X86_64
+  // The host calculates the arithmetic flags exactly like the guest, see the HostFlags op
+  static constexpr bool HostFlagsMatchGuest = true;
+#else
+  static constexpr bool HostFlagsMatchGuest = false;
+#endif
+  void GenerateFlags_Host(FEXCore::X86Tables::DecodedOp Op, uint8_t ALUOp, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF);
+
   void GenerateFlags_ADC(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, OrderedNode *CF);
   void GenerateFlags_SBB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, OrderedNode *CF);
   void GenerateFlags_SUB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF = true);
@@ -516,6 +530,8 @@ private:
 
   OrderedNode * GetX87Top();
   void SetX87Top(OrderedNode *Value);
+  OrderedNode * GetX87FCW();
+  void SetX87FCW(OrderedNode *Value);
 
   bool DestIsLockedMem(FEXCore::X86Tables::DecodedOp Op) {
     return Op->Dest.TypeNone.Type !=FEXCore::X86Tables::DecodedOperand::TYPE_GPR && (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_LOCK);
@@ -12,6 +12,41 @@ void IREmitter::ResetWorkingList() {
   CurrentCodeBlock = nullptr;
 }
 
+bool IREmitter::WritesGuestMemorySince(uint32_t FirstNode) {
+  uintptr_t DataBegin = Data.Begin();
+
+  for (uint32_t i = FirstNode; i < GetNodeCount(); ++i) {
+    switch (GetNode(i)->Op(DataBegin)->Op) {
+      case OP_STOREMEM:
+      case OP_STOREMEMTSO:
+      case OP_VSTOREMEMELEMENT:
+      case OP_CAS:
+      case OP_CASPAIR:
+      case OP_ATOMICADD:
+      case OP_ATOMICSUB:
+      case OP_ATOMICAND:
+      case OP_ATOMICOR:
+      case OP_ATOMICXOR:
+      case OP_ATOMICSWAP:
+      case OP_ATOMICFETCHADD:
+      case OP_ATOMICFETCHSUB:
+      case OP_ATOMICFETCHAND:
+      case OP_ATOMICFETCHOR:
+      case OP_ATOMICFETCHXOR:
+      // The host side can write anywhere
+      case OP_SYSCALL:
+      case OP_DIRECTSYSCALL:
+      case OP_INLINESYSCALL:
+      case OP_THUNK:
+        return true;
+      default:
+        break;
+    }
+  }
+
+  return false;
+}
+
 void IREmitter::ReplaceAllUsesWithRange(OrderedNode *Node, OrderedNode *NewNode, AllNodesIterator After, AllNodesIterator End) {
   uintptr_t ListBegin = ListData.Begin();
   auto NodeId = Node->Wrapped(ListBegin).ID();
@@ -2,25 +2,154 @@
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 #include "Interface/IR/PassManager.h"
 
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <array>
+
 namespace FEXCore::IR {
 
-void PassManager::AddDefaultPasses(bool InlineConstants) {
-  InsertPass(CreateContextLoadStoreElimination());
-  InsertPass(CreateDeadFlagStoreElimination());
-  InsertPass(CreateDeadGPRStoreElimination());
-  InsertPass(CreateDeadFPRStoreElimination());
-  InsertPass(CreatePassDeadCodeElimination());
-  InsertPass(CreateConstProp(InlineConstants));
+namespace {
+  struct PassDefinition {
+    std::string_view Name;
+    FEXCore::IR::Pass* (*Create)(bool InlineConstants);
+  };
+
+  const std::array<PassDefinition, 11> PassDefinitions = {{
+    {"ctxstore",      [](bool) { return CreateContextLoadStoreElimination(); }},
+    // Superseded by deadflagcalc, still available through a custom pipeline
+    {"deadflagstore", [](bool) { return CreateDeadFlagStoreElimination(); }},
+    {"deadgprstore",  [](bool) { return CreateDeadGPRStoreElimination(); }},
+    {"deadfprstore",  [](bool) { return CreateDeadFPRStoreElimination(); }},
+    {"dce",           [](bool) { return CreatePassDeadCodeElimination(); }},
+    {"constprop",     [](bool InlineConstants) { return CreateConstProp(InlineConstants); }},
+    {"deadflagcalc",  [](bool) { return CreateDeadFlagCalculationEliminination(); }},
+    {"syscallopt",    [](bool) { return CreateSyscallOptimization(); }},
+    // (UNSAFE) Only valid if the guest stack is thread private
+    {"stackslots",    [](bool) { return CreateStackSlotPromotion(); }},
+    // Backend specific lowering, these are no-ops or a pessimization on other hosts
+    {"addrfold",      [](bool InlineConstants) { return CreateAddressModeFolding(InlineConstants); }},
+    {"ctxpair",       [](bool) { return CreateContextPairing(); }},
+  }};
+
+  using PipelineList = std::vector<std::string_view>;
+
+  // InlineConstants is only set when the JIT is the backend
+  bool GetOptLevelPipeline(uint8_t OptLevel, bool InlineConstants, bool PrivateStack, PipelineList *Out) {
+    PipelineList Passes;
+    switch (OptLevel) {
+    case OPT_LEVEL_O0:
+      *Out = {"dce"};
+      return true;
+    case OPT_LEVEL_O1:
+      // DCE runs twice. Once to clean up after store elimination so ConstProp sees less
+      // Then again to clean up the nodes ConstProp orphaned
+      Passes = {"ctxstore", "deadflagcalc", "deadgprstore", "deadfprstore", "dce", "constprop", "syscallopt", "dce"};
+      break;
+    case OPT_LEVEL_O2:
+      // ConstProp and DCE can expose more dead context stores, so iterate the store elimination once more
+      Passes = {"ctxstore", "deadflagcalc", "deadgprstore", "deadfprstore", "dce", "constprop", "syscallopt", "dce",
+                "ctxstore", "deadflagcalc", "deadgprstore", "deadfprstore", "dce"};
+      break;
+    default:
+      LogMan::Msg::E("Unknown optimization level %d", OptLevel);
+      return false;
+    }
+
+#ifdef _M_X86_64
+    // Before ConstProp so it can inline the displacements left behind
+    // Only the JIT consumes the folded addressing modes, the interpreter would just compute them again
+    if (InlineConstants) {
+      Passes.insert(std::find(Passes.begin(), Passes.end(), "constprop"), "addrfold");
+    }
+#elif defined(_M_ARM_64)
+    // Paired context accesses become ldp/stp. Must come after the last store elimination, DCE cleans up after it
+    Passes.insert(Passes.end() - 1, "ctxpair");
+#endif
+
+    if (PrivateStack) {
+      // Needs ctxstore to have merged the stack pointer loads so that the slot addresses share a root
+      Passes.insert(Passes.begin() + 1, "stackslots");
+    }
+
+    *Out = std::move(Passes);
+    return true;
+  }
+
+  PassDefinition const *FindPass(std::string_view Name) {
+    for (auto &Def : PassDefinitions) {
+      if (Def.Name == Name) {
+        return &Def;
+      }
+    }
+    return nullptr;
+  }
+
+  bool ParsePipeline(std::string_view Pipeline, PipelineList *Passes) {
+    PipelineList Replacement;
+    bool HasReplacement{};
 
-  ////// InsertPass(CreateDeadFlagCalculationEliminination());
+    while (!Pipeline.empty()) {
+      size_t End = Pipeline.find(',');
+      std::string_view Entry = Pipeline.substr(0, End);
+      Pipeline.remove_prefix(End == std::string_view::npos ? Pipeline.size() : End + 1);
 
-  InsertPass(CreateSyscallOptimization());
-  InsertPass(CreatePassDeadCodeElimination());
+      if (Entry.empty()) {
+        continue;
+      }
+
+      char Modifier = Entry[0];
+      if (Modifier == '+' || Modifier == '-') {
+        Entry.remove_prefix(1);
+      }
+
+      if (!FindPass(Entry)) {
+        LogMan::Msg::E("Unknown pass '%.*s' in pass pipeline", static_cast<int>(Entry.size()), Entry.data());
+        return false;
+      }
+
+      if (Modifier == '+') {
+        Passes->emplace_back(Entry);
+      }
+      else if (Modifier == '-') {
+        std::erase(*Passes, Entry);
+      }
+      else {
+        HasReplacement = true;
+        Replacement.emplace_back(Entry);
+      }
+    }
+
+    if (HasReplacement) {
+      *Passes = std::move(Replacement);
+    }
+
+    return true;
+  }
+}
+
+bool PassManager::AddDefaultPasses(bool InlineConstants, uint8_t OptLevel, std::string_view Pipeline, bool PrivateStack) {
+  PipelineList Passes;
+  bool Result = GetOptLevelPipeline(OptLevel, InlineConstants, PrivateStack, &Passes);
+  if (!Result) {
+    // Still needs a working pipeline, the pass overrides were written against the rejected level so they are dropped too
+    GetOptLevelPipeline(OPT_LEVEL_DEFAULT, InlineConstants, PrivateStack, &Passes);
+  }
+  else if (!ParsePipeline(Pipeline, &Passes)) {
+    GetOptLevelPipeline(OptLevel, InlineConstants, PrivateStack, &Passes);
+    Result = false;
+  }
+
+  for (auto Name : Passes) {
+    InsertPass(FindPass(Name)->Create(InlineConstants));
+  }
 
   // If the IR is compacted post-RA then the node indexing gets messed up and the backend isn't able to find the register assigned to a node
   // Compact before IR, don't worry about RA generating spills/fills
   CompactionPass = CreateIRCompaction();
   InsertPass(CompactionPass);
+
+  return Result;
 }
 
 void PassManager::AddDefaultValidationPasses() {
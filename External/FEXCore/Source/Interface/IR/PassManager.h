@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 namespace FEXCore::HLE {
@@ -17,6 +18,19 @@ class SyscallOptimization;
 
 using ShouldExitHandler = std::function<void(void)>;
 
+/**
+ * @name Optimization levels
+ *
+ * O0: Minimal pipeline. Cheapest compile for cold code or the interpreter
+ * O1: Default pipeline
+ * O2: Iterates the store elimination passes a second time for hot code
+ * @{ */
+constexpr uint8_t OPT_LEVEL_O0 = 0;
+constexpr uint8_t OPT_LEVEL_O1 = 1;
+constexpr uint8_t OPT_LEVEL_O2 = 2;
+constexpr uint8_t OPT_LEVEL_DEFAULT = OPT_LEVEL_O1;
+/**  @} */
+
 class Pass {
 public:
   virtual ~Pass() = default;
@@ -33,7 +47,24 @@ protected:
 class PassManager final {
   friend class SyscallOptimization;
 public:
-  void AddDefaultPasses(bool InlineConstants);
+  /**
+   * @brief Adds the pass pipeline for an optimization level
+   *
+   * @param InlineConstants If ConstProp is allowed to inline constants in to ops
+   * @param OptLevel One of the OPT_LEVEL_* pipelines
+   * @param Pipeline Optional comma separated list of pass names
+   * @param PrivateStack If the guest stack is thread private, enables stack slot promotion
+   *
+   * A pipeline made only of `+Name` and `-Name` entries is applied on top of the optimization level's pipeline,
+   * appending or removing the named pass. Any bare pass name instead replaces the level's pipeline entirely.
+   * ex: "-constprop,+ctxpair" or "ctxstore,dce,syscallopt"
+   *
+   * IR compaction is always the last pass since register allocation relies on it.
+   *
+   * @return false if the optimization level is unknown or the pipeline couldn't be parsed.
+   *         An unparsable pipeline falls back to the optimization level's pipeline, an unknown level to OPT_LEVEL_DEFAULT
+   */
+  bool AddDefaultPasses(bool InlineConstants, uint8_t OptLevel = OPT_LEVEL_DEFAULT, std::string_view Pipeline = {}, bool PrivateStack = false);
   void AddDefaultValidationPasses();
   void InsertPass(Pass *Pass) {
     Pass->RegisterPassManager(this);
@@ -62,7 +93,7 @@ public:
 
 protected:
   ShouldExitHandler ExitHandler;
-  FEXCore::HLE::SyscallHandler *SyscallHandler;
+  FEXCore::HLE::SyscallHandler *SyscallHandler{};
 
 private:
   Pass *RAPass{};
@@ -7,6 +7,9 @@ class RegisterAllocationPass;
 FEXCore::IR::Pass* CreateConstProp(bool InlineConstants);
 FEXCore::IR::Pass* CreateContextLoadStoreElimination();
 FEXCore::IR::Pass* CreateSyscallOptimization();
+FEXCore::IR::Pass* CreateStackSlotPromotion();
+FEXCore::IR::Pass* CreateAddressModeFolding(bool InlineConstants);
+FEXCore::IR::Pass* CreateContextPairing();
 FEXCore::IR::Pass* CreateDeadFlagCalculationEliminination();
 FEXCore::IR::Pass* CreateDeadFlagStoreElimination();
 FEXCore::IR::Pass* CreateDeadGPRStoreElimination();
@@ -0,0 +1,225 @@
+#include "Interface/IR/Passes.h"
+#include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+namespace {
+  struct AddressTerms {
+    FEXCore::IR::OrderedNode *Base;
+    FEXCore::IR::OrderedNode *Index;
+    uint8_t Scale;
+    int64_t Displacement;
+  };
+}
+
+namespace FEXCore::IR {
+
+class AddressModeFolding final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+  AddressModeFolding(bool DoInlineConstants) : InlineConstants(DoInlineConstants) { }
+
+private:
+  bool InlineConstants;
+
+  bool AddTerm(IREmitter *IREmit, OrderedNodeWrapper Node, AddressTerms *Terms, uint32_t Depth);
+  bool FoldAddress(IREmitter *IREmit, OrderedNodeWrapper Addr, OrderedNode **Base, OrderedNode **Offset, uint8_t *Scale);
+
+  template<typename T>
+  bool FoldMemOp(IREmitter *IREmit, OrderedNode *CodeNode, T *Op, uint8_t OffsetArg);
+};
+
+// Walks an address computed from 64bit adds and breaks it in to x86 SIB terms
+bool AddressModeFolding::AddTerm(IREmitter *IREmit, OrderedNodeWrapper Node, AddressTerms *Terms, uint32_t Depth) {
+  auto Header = IREmit->GetOpHeader(Node);
+  uint64_t Constant{};
+
+  if (IREmit->IsValueConstant(Node, &Constant)) {
+    Terms->Displacement += Constant;
+    return true;
+  }
+
+  // Only 64bit math matches x86-64 address generation, 32bit guest addresses need to wrap
+  if (Header->Size == 8 && Depth < 4) {
+    if (Header->Op == OP_ADD) {
+      return AddTerm(IREmit, Header->Args[0], Terms, Depth + 1) &&
+             AddTerm(IREmit, Header->Args[1], Terms, Depth + 1);
+    }
+
+    if (!Terms->Index &&
+        (Header->Op == OP_MUL || Header->Op == OP_LSHL) &&
+        IREmit->IsValueConstant(Header->Args[1], &Constant)) {
+      uint64_t Scale = Header->Op == OP_MUL ? Constant : (Constant < 4 ? 1ULL << Constant : 0);
+      if (Scale == 1 || Scale == 2 || Scale == 4 || Scale == 8) {
+        Terms->Index = IREmit->UnwrapNode(Header->Args[0]);
+        Terms->Scale = Scale;
+        return true;
+      }
+    }
+  }
+
+  if (!Terms->Base) {
+    Terms->Base = IREmit->UnwrapNode(Node);
+    return true;
+  }
+
+  if (!Terms->Index) {
+    Terms->Index = IREmit->UnwrapNode(Node);
+    Terms->Scale = 1;
+    return true;
+  }
+
+  // More registers than a ModRM can address
+  return false;
+}
+
+bool AddressModeFolding::FoldAddress(IREmitter *IREmit, OrderedNodeWrapper Addr, OrderedNode **Base, OrderedNode **Offset, uint8_t *Scale) {
+  auto AddressHeader = IREmit->GetOpHeader(Addr);
+  if (AddressHeader->Op != OP_ADD || AddressHeader->Size != 8) {
+    return false;
+  }
+
+  AddressTerms Terms{};
+  if (!AddTerm(IREmit, Addr, &Terms, 0) ||
+      static_cast<int32_t>(Terms.Displacement) != Terms.Displacement) {
+    return false;
+  }
+
+  // Only [Disp] and [Index * Scale] are left, neither saves anything
+  if (!Terms.Base && (!Terms.Index || !Terms.Displacement)) {
+    return false;
+  }
+
+  // Everything gets emitted after the address calculation so it is dominated by all of the terms
+  IREmit->SetWriteCursor(IREmit->UnwrapNode(Addr));
+
+  auto Displacement = [&]() -> OrderedNode* {
+    if (InlineConstants) {
+      return IREmit->_InlineConstant(Terms.Displacement);
+    }
+    return IREmit->_Constant(64, Terms.Displacement);
+  };
+
+  if (!Terms.Index) {
+    // [Base + Disp]
+    if (!Terms.Displacement) {
+      return false;
+    }
+
+    *Base = Terms.Base;
+    *Offset = Displacement();
+    *Scale = 1;
+    return true;
+  }
+
+  // [Base + Index * Scale + Disp]
+  // Memory ops don't have a displacement, so Base + Disp is the one add left
+  if (!Terms.Base) {
+    *Base = IREmit->_Constant(64, Terms.Displacement);
+  }
+  else if (Terms.Displacement > 0) {
+    *Base = IREmit->_Add(Terms.Base, Displacement());
+  }
+  else if (Terms.Displacement) {
+    // Add's inline constant isn't sign extended
+    *Base = IREmit->_Add(Terms.Base, IREmit->_Constant(64, Terms.Displacement));
+  }
+  else {
+    *Base = Terms.Base;
+  }
+
+  *Offset = Terms.Index;
+  *Scale = Terms.Scale;
+  return true;
+}
+
+template<typename T>
+bool AddressModeFolding::FoldMemOp(IREmitter *IREmit, OrderedNode *CodeNode, T *Op, uint8_t OffsetArg) {
+  OrderedNode *Base{};
+  OrderedNode *Offset{};
+  uint8_t Scale{};
+
+  if (!Op->Offset.IsInvalid()) {
+    return false;
+  }
+
+  // InlineConstants is only set for the JIT. The interpreter ignores the offset on its TSO and 128bit memory ops
+  if (!InlineConstants &&
+      (Op->Header.Op == OP_LOADMEMTSO ||
+       Op->Header.Op == OP_STOREMEMTSO ||
+       Op->Size == 16)) {
+    return false;
+  }
+
+  if (!FoldAddress(IREmit, Op->Addr, &Base, &Offset, &Scale)) {
+    return false;
+  }
+
+  Op->OffsetType = MEM_OFFSET_SXTX;
+  Op->OffsetScale = Scale;
+  IREmit->ReplaceNodeArgument(CodeNode, 0, Base);
+  IREmit->ReplaceNodeArgument(CodeNode, OffsetArg, Offset);
+  return true;
+}
+
+/**
+ * @brief Folds x86 SIB style address arithmetic in to memory ops
+ *
+ * The OpcodeDispatcher emits `[Base + Index * Scale + Disp]` as a Mul (or Lshl) and two Adds.
+ * The x86-64 ModRM can encode all of that, so the memory op's Addr/Offset/OffsetScale are rewritten to
+ * Base and Index * Scale, leaving at most one Add for the displacement.
+ *
+ * eg.
+ *   %ssa9 i64 = Mul %ssa7 i64, %ssa8 i64 (Constant 4)
+ *   %ssa10 i64 = Add %ssa9 i64, %ssa6 i64
+ *   %ssa12 i64 = Add %ssa10 i64, %ssa11 i64 (Constant 0x10)
+ *   %ssa13 i32 = LoadMemTSO %ssa12 i64, %Invalid, #0x4, #0x4, GPR, SXTX, #0x1
+ * Converts to
+ *   %ssa14 i64 = Add %ssa6 i64, %ssa15 (InlineConstant 0x10)
+ *   %ssa13 i32 = LoadMemTSO %ssa14 i64, %ssa7 i64, #0x4, #0x4, GPR, SXTX, #0x4
+ *
+ * The TSO ops are plain movs on an x86 host, so they are folded as well.
+ * Only enabled for x86-64 hosts, other backends can't encode the Index register with an arbitrary scale.
+ * The default pipeline only runs this for the JIT. A custom pipeline on the interpreter leaves TSO and 128bit ops alone.
+ */
+bool AddressModeFolding::Run(IREmitter *IREmit) {
+#ifdef _M_X86_64
+  bool Changed = false;
+  auto CurrentIR = IREmit->ViewIR();
+  auto OriginalWriteCursor = IREmit->GetWriteCursor();
+
+  auto HeaderOp = CurrentIR.GetHeader();
+  if (HeaderOp->ShouldInterpret) {
+    return false;
+  }
+
+  for (auto [CodeNode, IROp] : CurrentIR.GetAllCode()) {
+    switch (IROp->Op) {
+      case OP_LOADMEM:
+        Changed |= FoldMemOp(IREmit, CodeNode, IROp->CW<IR::IROp_LoadMem>(), 1);
+        break;
+      case OP_LOADMEMTSO:
+        Changed |= FoldMemOp(IREmit, CodeNode, IROp->CW<IR::IROp_LoadMemTSO>(), 1);
+        break;
+      case OP_STOREMEM:
+        Changed |= FoldMemOp(IREmit, CodeNode, IROp->CW<IR::IROp_StoreMem>(), 2);
+        break;
+      case OP_STOREMEMTSO:
+        Changed |= FoldMemOp(IREmit, CodeNode, IROp->CW<IR::IROp_StoreMemTSO>(), 2);
+        break;
+      default: break;
+    }
+  }
+
+  IREmit->SetWriteCursor(OriginalWriteCursor);
+
+  return Changed;
+#else
+  return false;
+#endif
+}
+
+FEXCore::IR::Pass* CreateAddressModeFolding(bool InlineConstants) {
+  return new AddressModeFolding(InlineConstants);
+}
+
+}
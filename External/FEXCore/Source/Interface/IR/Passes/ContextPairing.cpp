@@ -0,0 +1,194 @@
+#include "Interface/IR/Passes.h"
+#include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+  struct ContextAccess {
+    uint32_t Offset;
+    uint8_t Size;
+    FEXCore::IR::OrderedNode *Node;
+    FEXCore::IR::OrderedNode *Value; ///< Value being stored, nullptr for loads
+  };
+}
+
+namespace FEXCore::IR {
+
+class ContextPairing final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+
+private:
+  // Accesses that can still be moved to their partner without crossing anything that touches the context
+  std::vector<ContextAccess> PendingLoads;
+  std::vector<ContextAccess> PendingStores;
+
+  static bool Overlaps(ContextAccess const &Access, uint32_t Offset, uint8_t Size) {
+    return Access.Offset < (Offset + Size) && Offset < (Access.Offset + Access.Size);
+  }
+
+  static void DropOverlapping(std::vector<ContextAccess> *Accesses, uint32_t Offset, uint8_t Size) {
+    std::erase_if(*Accesses, [Offset, Size](ContextAccess const &Access) {
+      return Overlaps(Access, Offset, Size);
+    });
+  }
+
+  // Whether the access or either slot it could pair with overlaps the range
+  static bool PairRangeOverlaps(ContextAccess const &Access, uint32_t Offset, uint8_t Size) {
+    uint64_t PairStart = Access.Offset >= Access.Size ? Access.Offset - Access.Size : 0;
+    uint64_t PairEnd = static_cast<uint64_t>(Access.Offset) + Access.Size * 2;
+    return PairStart < (static_cast<uint64_t>(Offset) + Size) && Offset < PairEnd;
+  }
+
+  static std::vector<ContextAccess>::iterator FindPartner(std::vector<ContextAccess> *Accesses, uint32_t Offset, uint8_t Size) {
+    return std::find_if(Accesses->begin(), Accesses->end(), [Offset, Size](ContextAccess const &Access) {
+      return Access.Size == Size &&
+        (Access.Offset + Size == Offset || Offset + Size == Access.Offset);
+    });
+  }
+
+  bool PairLoad(IREmitter *IREmit, OrderedNode *CodeNode, IROp_LoadContext const *Op);
+  bool PairStore(IREmitter *IREmit, OrderedNode *CodeNode, IROp_StoreContext const *Op);
+};
+
+bool ContextPairing::PairLoad(IREmitter *IREmit, OrderedNode *CodeNode, IROp_LoadContext const *Op) {
+  uint8_t Size = Op->Header.Size;
+
+  // Stores before this can't be moved past the load anymore
+  DropOverlapping(&PendingStores, Op->Offset, Size);
+
+  if (Op->Class != GPRClass || (Size != 4 && Size != 8)) {
+    return false;
+  }
+
+  auto Partner = FindPartner(&PendingLoads, Op->Offset, Size);
+  if (Partner == PendingLoads.end()) {
+    PendingLoads.emplace_back(ContextAccess{Op->Offset, Size, CodeNode, nullptr});
+    return false;
+  }
+
+  // Hoist this load up to the earlier one, nothing between them could have written either location
+  OrderedNode *Earlier = Partner->Node;
+  uint32_t PairOffset = std::min(Partner->Offset, Op->Offset);
+  bool EarlierIsLower = Partner->Offset == PairOffset;
+  PendingLoads.erase(Partner);
+
+  IREmit->SetWriteCursor(Earlier);
+  auto Pair = IREmit->_LoadContextPair(Size, PairOffset, GPRPairClass);
+  OrderedNode *Lower = IREmit->_ExtractElementPair(Pair, 0);
+  OrderedNode *Upper = IREmit->_ExtractElementPair(Pair, 1);
+
+  IREmit->ReplaceAllUsesWith(Earlier, EarlierIsLower ? Lower : Upper);
+  IREmit->ReplaceAllUsesWith(CodeNode, EarlierIsLower ? Upper : Lower);
+  return true;
+}
+
+bool ContextPairing::PairStore(IREmitter *IREmit, OrderedNode *CodeNode, IROp_StoreContext const *Op) {
+  uint8_t Size = Op->Header.Size;
+
+  // Loads before this can't be moved past the store anymore
+  // Neither can a later load of the stored location pair with one of them, it would be hoisted above this store
+  std::erase_if(PendingLoads, [Op, Size](ContextAccess const &Access) {
+    return PairRangeOverlaps(Access, Op->Offset, Size);
+  });
+
+  auto Value = IREmit->UnwrapNode(Op->Header.Args[0]);
+  if (Op->Class != GPRClass || (Size != 4 && Size != 8) || IREmit->GetOpSize(Value) != Size) {
+    DropOverlapping(&PendingStores, Op->Offset, Size);
+    return false;
+  }
+
+  auto Partner = FindPartner(&PendingStores, Op->Offset, Size);
+  if (Partner == PendingStores.end()) {
+    DropOverlapping(&PendingStores, Op->Offset, Size);
+    PendingStores.emplace_back(ContextAccess{Op->Offset, Size, CodeNode, Value});
+    return false;
+  }
+
+  // Sink the earlier store down to this one, nothing between them read either location
+  OrderedNode *Earlier = Partner->Node;
+  OrderedNode *EarlierValue = Partner->Value;
+  uint32_t PairOffset = std::min(Partner->Offset, Op->Offset);
+  bool EarlierIsLower = Partner->Offset == PairOffset;
+  PendingStores.erase(Partner);
+
+  IREmit->SetWriteCursor(CodeNode);
+  auto Pair = IREmit->_CreateElementPair(EarlierIsLower ? EarlierValue : Value, EarlierIsLower ? Value : EarlierValue);
+  IREmit->_StoreContextPair(Pair, Size, PairOffset, GPRPairClass);
+
+  IREmit->Remove(Earlier);
+  IREmit->Remove(CodeNode);
+  return true;
+}
+
+/**
+ * @brief Merges adjacent GPR context accesses in to LoadContextPair/StoreContextPair
+ *
+ * eg.
+ *   %ssa7 i64 = LoadContext #0x8, #0x10, GPR
+ *   %ssa8 i64 = Add %ssa7 i64, %ssa6 i64
+ *   %ssa9 i64 = LoadContext #0x8, #0x18, GPR
+ * Converts to
+ *   %ssa10 i64 = LoadContextPair #0x8, #0x10, GPRPair
+ *   %ssa11 i64 = ExtractElementPair %ssa10 i64, #0x0
+ *   %ssa12 i64 = ExtractElementPair %ssa10 i64, #0x1
+ *   %ssa8 i64 = Add %ssa11 i64, %ssa6 i64
+ *
+ * Loads are hoisted to the earlier load and stores are sunk to the later store, so this must not cross anything else
+ * that accesses the same context locations or has side effects.
+ * Needs to run after context load/store elimination since that treats the pair ops as barriers.
+ */
+bool ContextPairing::Run(IREmitter *IREmit) {
+  bool Changed = false;
+  auto CurrentIR = IREmit->ViewIR();
+  auto OriginalWriteCursor = IREmit->GetWriteCursor();
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    PendingLoads.clear();
+    PendingStores.clear();
+
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      switch (IROp->Op) {
+        case OP_LOADCONTEXT: {
+          auto Op = IROp->C<IR::IROp_LoadContext>();
+          Changed |= PairLoad(IREmit, CodeNode, Op);
+          break;
+        }
+        case OP_STORECONTEXT: {
+          auto Op = IROp->C<IR::IROp_StoreContext>();
+          Changed |= PairStore(IREmit, CodeNode, Op);
+          break;
+        }
+
+        // Flags live in the context but never overlap the GPRs
+        case OP_LOADFLAG:
+        case OP_STOREFLAG:
+        // Guest memory is never the context
+        case OP_STOREMEM:
+        case OP_STOREMEMTSO:
+          break;
+
+        default:
+          if (IR::HasSideEffects(IROp->Op) ||
+              IROp->Op == OP_LOADCONTEXTINDEXED ||
+              IROp->Op == OP_LOADCONTEXTPAIR) {
+            PendingLoads.clear();
+            PendingStores.clear();
+          }
+          break;
+      }
+    }
+  }
+
+  IREmit->SetWriteCursor(OriginalWriteCursor);
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateContextPairing() {
+  return new ContextPairing{};
+}
+
+}
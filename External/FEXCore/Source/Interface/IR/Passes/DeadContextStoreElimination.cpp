@@ -30,7 +30,7 @@ namespace {
 
   using ContextInfo = std::vector<ContextMemberInfo>;
 
-  constexpr static std::array<LastAccessType, 14> DefaultAccess = {
+  constexpr static std::array<LastAccessType, 15> DefaultAccess = {
     ACCESS_NONE,
     ACCESS_NONE,
     ACCESS_INVALID, // PAD
@@ -45,6 +45,7 @@ namespace {
     ACCESS_INVALID, // PAD
     ACCESS_NONE,
     ACCESS_NONE,
+    ACCESS_NONE,
   };
 
   static void ClassifyContextStruct(ContextInfo *ContextClassification) {
@@ -185,6 +186,15 @@ namespace {
       });
     }
 
+    ContextClassification->emplace_back(ContextMemberInfo{
+      ContextMemberClassification {
+        offsetof(FEXCore::Core::CPUState, FCW),
+        sizeof(FEXCore::Core::CPUState::FCW),
+      },
+      DefaultAccess[14],
+      FEXCore::IR::InvalidClass,
+    });
+
     size_t ClassifiedStructSize{};
     for (auto &it : *ContextClassification) {
       ClassifiedStructSize += it.Class.Size;
@@ -234,6 +244,8 @@ namespace {
     for (size_t i = 0; i < 32; ++i) {
       SetAccess(Offset++, DefaultAccess[13]);
     }
+
+    SetAccess(Offset++, DefaultAccess[14]);
   }
 
   struct BlockInfo {
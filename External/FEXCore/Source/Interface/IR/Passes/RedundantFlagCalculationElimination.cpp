@@ -1,52 +1,176 @@
 #include "Interface/IR/PassManager.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <unordered_map>
+#include <vector>
+
+namespace {
+  constexpr uint64_t ALL_FLAGS = ~0ULL;
+
+  struct BlockFlagInfo {
+    uint64_t Gen{};     ///< Flags read before being written in this block
+    uint64_t Kill{};    ///< Flags written in this block
+    uint64_t LiveIn{};
+    uint64_t LiveOut{};
+    bool ExitsRegion{}; ///< Leaves the IR, flags are live out
+    std::vector<uint32_t> Successors;
+  };
+}
+
 namespace FEXCore::IR {
 
 class DeadFlagCalculationEliminination final : public FEXCore::IR::Pass {
 public:
   bool Run(IREmitter *IREmit) override;
+
+private:
+  std::vector<BlockFlagInfo> Blocks;
+  std::unordered_map<OrderedNode*, uint32_t> BlockIndex;
+  std::vector<std::pair<OrderedNode*, IROp_Header*>> BlockCode;
+
+  static bool ReadsAllFlags(IROp_Header const *IROp);
 };
 
+// Anything that can leave the block early or hand the context to someone else could observe the flags
+bool DeadFlagCalculationEliminination::ReadsAllFlags(IROp_Header const *IROp) {
+  switch (IROp->Op) {
+    case OP_STORECONTEXT:
+    case OP_STORECONTEXTPAIR:
+    case OP_STORECONTEXTINDEXED:
+    case OP_STOREMEM:
+    case OP_STOREMEMTSO:
+    case OP_JUMP:
+    case OP_CONDJUMP:
+    case OP_ENDBLOCK:
+      return false;
+    default:
+      return IR::HasSideEffects(IROp->Op);
+  }
+}
+
 /**
- * @brief (UNSAFE) This pass removes flag calculations that will otherwise be unused INSIDE of that block
- *
- * Compilers don't really do any form of cross-block flag allocation like they do RA with GPRs.
- * This ends up with them recalculating flags across blocks regardless of if it is actually possible to reuse the flags.
- * This is an additional burden in x86 that most instructions change flags when called, so it is easier to recalculate anyway.
+ * @brief Removes flag calculations that are overwritten on every path before being read
  *
- * This is unsafe since handwritten code can easily break this assumption.
- * This may be more interesting with full function level recompilation since flags definitely won't be used across function boundaries.
+ * Global liveness over the blocks of the IR region:
+ * 1) Each block gets its upward exposed flag reads (Gen) and flag writes (Kill), along with its successors
+ * 2) LiveIn = Gen | (LiveOut & ~Kill), LiveOut = union of the successors' LiveIn, iterated until it settles
+ * 3) Walking each block backwards from its LiveOut, any StoreFlag of a dead flag is removed
+ *    DCE then cleans up the calculation that fed it
  *
+ * Blocks that leave the region (ExitFunction) treat every flag as live, since the next block could read them.
+ * The OpcodeDispatcher emits InvalidateFlags in front of call and ret when the ABI says flags are local,
+ * which is the only cross-block summary we have, so those kill the flags like any other write.
+ * Ops with side effects that could observe the context (syscalls, helpers, breaks) read every flag.
  */
 bool DeadFlagCalculationEliminination::Run(IREmitter *IREmit) {
-  std::array<OrderedNode*, 32> LastValidFlagStores{};
-
   bool Changed = false;
   auto CurrentIR = IREmit->ViewIR();
 
+  Blocks.clear();
+  BlockIndex.clear();
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    BlockIndex[BlockNode] = Blocks.size();
+    Blocks.emplace_back();
+  }
+
+  // Pass 1
+  // Local Gen/Kill and the region CFG
   for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    auto &Info = Blocks[BlockIndex[BlockNode]];
+    bool HasSuccessor = false;
+
     for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
       if (IROp->Op == OP_STOREFLAG) {
-        auto Op = IROp->CW<IR::IROp_StoreFlag>();
-        // Set this node as the last one valid for this flag
-        LastValidFlagStores[Op->Flag] = CodeNode;
+        auto Op = IROp->C<IR::IROp_StoreFlag>();
+        Info.Kill |= 1ULL << Op->Flag;
+      }
+      else if (IROp->Op == OP_INVALIDATEFLAGS) {
+        auto Op = IROp->C<IR::IROp_InvalidateFlags>();
+        Info.Kill |= Op->Flags;
       }
       else if (IROp->Op == OP_LOADFLAG) {
-        auto Op = IROp->CW<IR::IROp_LoadFlag>();
-        LastValidFlagStores[Op->Flag] = nullptr;
+        auto Op = IROp->C<IR::IROp_LoadFlag>();
+        Info.Gen |= (1ULL << Op->Flag) & ~Info.Kill;
+      }
+      else if (IROp->Op == OP_JUMP) {
+        auto Op = IROp->C<IR::IROp_Jump>();
+        Info.Successors.emplace_back(BlockIndex[CurrentIR.GetNode(Op->Header.Args[0])]);
+        HasSuccessor = true;
+      }
+      else if (IROp->Op == OP_CONDJUMP) {
+        auto Op = IROp->C<IR::IROp_CondJump>();
+        Info.Successors.emplace_back(BlockIndex[CurrentIR.GetNode(Op->TrueBlock)]);
+        Info.Successors.emplace_back(BlockIndex[CurrentIR.GetNode(Op->FalseBlock)]);
+        HasSuccessor = true;
+      }
+      else if (ReadsAllFlags(IROp)) {
+        Info.Gen |= ~Info.Kill;
       }
     }
 
-    // If any flags are stored but not loaded by the end of the block, then erase them
-    for (auto &Flag : LastValidFlagStores) {
-      if (Flag != nullptr) {
-        IREmit->Remove(Flag);
-        Changed = true;
+    Info.ExitsRegion = !HasSuccessor;
+  }
+
+  // Pass 2
+  // Iterate liveness to a fixed point, backwards converges fastest
+  bool LivenessChanged = true;
+  while (LivenessChanged) {
+    LivenessChanged = false;
+
+    for (size_t i = Blocks.size(); i-- > 0;) {
+      auto &Info = Blocks[i];
+
+      uint64_t LiveOut = Info.ExitsRegion ? ALL_FLAGS : 0;
+      for (auto Successor : Info.Successors) {
+        LiveOut |= Blocks[Successor].LiveIn;
+      }
+
+      uint64_t LiveIn = Info.Gen | (LiveOut & ~Info.Kill);
+      if (LiveIn != Info.LiveIn || LiveOut != Info.LiveOut) {
+        Info.LiveIn = LiveIn;
+        Info.LiveOut = LiveOut;
+        LivenessChanged = true;
       }
     }
+  }
+
+  // Pass 3
+  // Remove stores to flags that are dead at that point
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    BlockCode.clear();
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      BlockCode.emplace_back(CodeNode, IROp);
+    }
+
+    uint64_t Live = Blocks[BlockIndex[BlockNode]].LiveOut;
+
+    for (auto it = BlockCode.rbegin(); it != BlockCode.rend(); ++it) {
+      auto [CodeNode, IROp] = *it;
 
-    LastValidFlagStores.fill(nullptr);
+      if (IROp->Op == OP_STOREFLAG) {
+        auto Op = IROp->C<IR::IROp_StoreFlag>();
+        uint64_t Flag = 1ULL << Op->Flag;
+        if (Live & Flag) {
+          Live &= ~Flag;
+        }
+        else {
+          IREmit->Remove(CodeNode);
+          Changed = true;
+        }
+      }
+      else if (IROp->Op == OP_INVALIDATEFLAGS) {
+        auto Op = IROp->C<IR::IROp_InvalidateFlags>();
+        Live &= ~Op->Flags;
+      }
+      else if (IROp->Op == OP_LOADFLAG) {
+        auto Op = IROp->C<IR::IROp_LoadFlag>();
+        Live |= 1ULL << Op->Flag;
+      }
+      else if (ReadsAllFlags(IROp)) {
+        Live = ALL_FLAGS;
+      }
+    }
   }
 
   return Changed;
@@ -3,6 +3,7 @@
 #include "Interface/IR/Passes.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <algorithm>
 #include <iterator>
 #include <unordered_set>
 
@@ -29,7 +30,6 @@ namespace {
       uint64_t RegAndClass;
       uint32_t InterferenceCount;
       uint32_t BlockID;
-      uint32_t SpillSlot;
       RegisterNode *PhiPartner;
     } Head;
 
@@ -43,7 +43,6 @@ namespace {
     .RegAndClass = INVALID_REGCLASS,
     .InterferenceCount = 0,
     .BlockID = ~0U,
-    .SpillSlot = ~0U,
     .PhiPartner = nullptr,
   };
 
@@ -58,11 +57,12 @@ namespace {
     uint32_t RematCost;
   };
 
-  struct SpillStackUnit {
-    uint32_t Node;
-    FEXCore::IR::RegisterClassType Class;
-    LiveRange SpillRange;
-    FEXCore::IR::OrderedNode *SpilledNode;
+  struct SpillSlotRange {
+    uint32_t Begin;
+    uint32_t End;
+    uint32_t BlockID;
+    uint8_t Size;
+    bool MultiBlock; ///< Accessed from more than one block, live for the entire IR
   };
 
   struct RegisterGraph {
@@ -71,7 +71,6 @@ namespace {
     BitSet<uint64_t> InterferenceSet;
     uint32_t NodeCount;
     uint32_t MaxNodeCount;
-    std::vector<SpillStackUnit> SpillStack;
     std::unordered_map<uint32_t, std::unordered_set<uint32_t>> BlockPredecessors;
     std::unordered_map<uint32_t, std::unordered_set<uint32_t>> VisitedNodePredecessors;
   };
@@ -286,10 +285,12 @@ namespace FEXCore::IR {
        * Top 32bits is the class, lower 32bits is the register
        */
       uint64_t GetNodeRegister(uint32_t Node) override;
+      void GetLiveAcrossNode(uint32_t Node, std::vector<uint64_t> *Registers) override;
     private:
 
       std::vector<uint32_t> PhysicalRegisterCount;
       std::vector<uint32_t> TopRAPressure;
+      uint32_t AllocatedSSACount{};
 
       RegisterGraph *Graph;
       FEXCore::IR::Pass* CompactionPass;
@@ -315,7 +316,11 @@ namespace FEXCore::IR {
       FEXCore::IR::AllNodesIterator FindLastUseBefore(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode* Node, FEXCore::IR::AllNodesIterator Begin, FEXCore::IR::AllNodesIterator End);
 
       uint32_t FindNodeToSpill(IREmitter *IREmit, RegisterNode *RegisterNode, uint32_t CurrentLocation, LiveRange const *OpLiveRange, int32_t RematCost = -1);
-      uint32_t FindSpillSlot(uint32_t Node, FEXCore::IR::RegisterClassType RegisterClass);
+      uint32_t FindSpillSlot(FEXCore::IR::IROp_Header const *IROp);
+      void AllocateSpillSlots(FEXCore::IR::IREmitter *IREmit);
+      std::vector<SpillSlotRange> SpillSlotRanges;
+      std::vector<uint32_t> SpillSlotOrder;
+      std::vector<uint32_t> SpillSlotMapping;
 
       bool RunAllocateVirtualRegisters(IREmitter *IREmit);
   };
@@ -354,6 +359,22 @@ namespace FEXCore::IR {
     return Graph->Nodes[Node].Head.RegAndClass;
   }
 
+  void ConstrainedRAPass::GetLiveAcrossNode(uint32_t Node, std::vector<uint64_t> *Registers) {
+    Registers->clear();
+
+    // Live ranges are already expanded over the blocks a value flows through, so a linear check is enough
+    for (uint32_t i = 0; i < AllocatedSSACount; ++i) {
+      uint64_t RegAndClass = Graph->Nodes[i].Head.RegAndClass;
+      if (RegAndClass == INVALID_REGCLASS) {
+        continue;
+      }
+
+      if (LiveRanges[i].Begin < Node && LiveRanges[i].End > Node) {
+        Registers->emplace_back(RegAndClass);
+      }
+    }
+  }
+
   void ConstrainedRAPass::RecursiveLiveRangeExpansion(FEXCore::IR::IRListView<false> *IR, uint32_t Node, uint32_t DefiningBlockID, LiveRange *LiveRange, const std::unordered_set<uint32_t> &Predecessors, std::unordered_set<uint32_t> &VisitedPredecessors) {
     for (auto PredecessorId: Predecessors) {
       if (DefiningBlockID != PredecessorId && !VisitedPredecessors.contains(PredecessorId)) {
@@ -900,27 +921,136 @@ namespace FEXCore::IR {
     return RegisterNode->InterferenceList[InterferenceToSpill];
   }
 
-  uint32_t ConstrainedRAPass::FindSpillSlot(uint32_t Node, FEXCore::IR::RegisterClassType RegisterClass) {
-    RegisterNode *CurrentNode = &Graph->Nodes[Node];
-    LiveRange *NodeLiveRange = &LiveRanges[Node];
-    for (uint32_t i = 0; i < Graph->SpillStack.size(); ++i) {
-      SpillStackUnit *SpillUnit = &Graph->SpillStack.at(i);
-      if (NodeLiveRange->Begin <= SpillUnit->SpillRange.End &&
-          SpillUnit->SpillRange.Begin <= NodeLiveRange->End) {
-        SpillUnit->SpillRange.Begin = std::min(SpillUnit->SpillRange.Begin, LiveRanges[Node].Begin);
-        SpillUnit->SpillRange.End = std::max(SpillUnit->SpillRange.End, LiveRanges[Node].End);
-        CurrentNode->Head.SpillSlot = i;
-        return i;
+  uint32_t ConstrainedRAPass::FindSpillSlot(FEXCore::IR::IROp_Header const *IROp) {
+    // A value that was already filled from a slot is still there, so it can be filled again without storing it
+    if (IROp->Op == IR::OP_FILLREGISTER) {
+      return IROp->C<IR::IROp_FillRegister>()->Slot;
+    }
+
+    // Virtual slot per spilled value, AllocateSpillSlots packs them once RA is done
+    return SpillSlotCount++;
+  }
+
+  /**
+   * @brief Assigns the virtual spill slots to offsets in the spill area
+   *
+   * Each slot's live range runs from its first spill to its last fill. Slots whose ranges don't overlap share memory.
+   * Slots touched from more than one block are kept live for the whole IR, since the linear range doesn't account for
+   * control flow.
+   * Values up to 8 bytes get an 8 byte slot, vectors get a 16 byte aligned slot.
+   *
+   * Afterwards Slot is in 8 byte units and SpillSlotCount is the spill area size in 8 byte units, kept 16 byte aligned.
+   */
+  void ConstrainedRAPass::AllocateSpillSlots(FEXCore::IR::IREmitter *IREmit) {
+    if (!SpillSlotCount) {
+      return;
+    }
+
+    auto IR = IREmit->ViewIR();
+
+    SpillSlotRanges.assign(SpillSlotCount, SpillSlotRange{~0U, 0, ~0U, 0, false});
+
+    for (auto [BlockNode, BlockHeader] : IR.GetBlocks()) {
+      uint32_t BlockID = IR.GetID(BlockNode);
+      for (auto [CodeNode, IROp] : IR.GetCode(BlockNode)) {
+        uint32_t Slot{};
+        if (IROp->Op == IR::OP_SPILLREGISTER) {
+          Slot = IROp->C<IR::IROp_SpillRegister>()->Slot;
+        }
+        else if (IROp->Op == IR::OP_FILLREGISTER) {
+          Slot = IROp->C<IR::IROp_FillRegister>()->Slot;
+        }
+        else {
+          continue;
+        }
+
+        uint32_t Node = IR.GetID(CodeNode);
+        auto &Range = SpillSlotRanges[Slot];
+        Range.Begin = std::min(Range.Begin, Node);
+        Range.End = std::max(Range.End, Node);
+        Range.Size = std::max(Range.Size, IROp->Size);
+        if (Range.BlockID == ~0U) {
+          Range.BlockID = BlockID;
+        }
+        else if (Range.BlockID != BlockID) {
+          Range.MultiBlock = true;
+        }
       }
     }
 
-    // Couldn't find a spill slot so just make a new one
-    auto StackItem = Graph->SpillStack.emplace_back(SpillStackUnit{Node, RegisterClass});
-    StackItem.SpillRange.Begin = NodeLiveRange->Begin;
-    StackItem.SpillRange.End = NodeLiveRange->End;
-    CurrentNode->Head.SpillSlot = SpillSlotCount;
-    SpillSlotCount++;
-    return CurrentNode->Head.SpillSlot;
+    SpillSlotOrder.clear();
+    for (uint32_t i = 0; i < SpillSlotRanges.size(); ++i) {
+      auto &Range = SpillSlotRanges[i];
+      if (Range.BlockID == ~0U) {
+        // Every use was removed
+        continue;
+      }
+
+      if (Range.MultiBlock) {
+        Range.Begin = 0;
+        Range.End = ~0U;
+      }
+      SpillSlotOrder.emplace_back(i);
+    }
+
+    std::sort(SpillSlotOrder.begin(), SpillSlotOrder.end(), [this](uint32_t lhs, uint32_t rhs) {
+      return SpillSlotRanges[lhs].Begin < SpillSlotRanges[rhs].Begin;
+    });
+
+    // Linear scan over the ranges, each physical slot remembers where its last range ended
+    struct PhysicalSlot {
+      uint32_t End;
+      bool Wide;
+    };
+    std::vector<PhysicalSlot> PhysicalSlots;
+    SpillSlotMapping.assign(SpillSlotRanges.size(), ~0U);
+
+    for (auto Slot : SpillSlotOrder) {
+      auto &Range = SpillSlotRanges[Slot];
+      bool Wide = Range.Size > 8;
+
+      auto Free = std::find_if(PhysicalSlots.begin(), PhysicalSlots.end(), [&](PhysicalSlot const &Physical) {
+        return Physical.Wide == Wide && Physical.End < Range.Begin;
+      });
+
+      if (Free != PhysicalSlots.end()) {
+        Free->End = Range.End;
+        SpillSlotMapping[Slot] = std::distance(PhysicalSlots.begin(), Free);
+      }
+      else {
+        SpillSlotMapping[Slot] = PhysicalSlots.size();
+        PhysicalSlots.emplace_back(PhysicalSlot{Range.End, Wide});
+      }
+    }
+
+    // Wide slots go first so they stay 16 byte aligned, narrow slots are packed after them
+    std::vector<uint32_t> PhysicalOffsets(PhysicalSlots.size());
+    uint32_t Offset = 0;
+    for (uint32_t i = 0; i < PhysicalSlots.size(); ++i) {
+      if (PhysicalSlots[i].Wide) {
+        PhysicalOffsets[i] = Offset;
+        Offset += 2;
+      }
+    }
+    for (uint32_t i = 0; i < PhysicalSlots.size(); ++i) {
+      if (!PhysicalSlots[i].Wide) {
+        PhysicalOffsets[i] = Offset;
+        Offset += 1;
+      }
+    }
+
+    for (auto [CodeNode, IROp] : IR.GetAllCode()) {
+      if (IROp->Op == IR::OP_SPILLREGISTER) {
+        auto Op = IROp->CW<IR::IROp_SpillRegister>();
+        Op->Slot = PhysicalOffsets[SpillSlotMapping[Op->Slot]];
+      }
+      else if (IROp->Op == IR::OP_FILLREGISTER) {
+        auto Op = IROp->CW<IR::IROp_FillRegister>();
+        Op->Slot = PhysicalOffsets[SpillSlotMapping[Op->Slot]];
+      }
+    }
+
+    SpillSlotCount = AlignUp(Offset, 2);
   }
 
   void ConstrainedRAPass::SpillRegisters(FEXCore::IR::IREmitter *IREmit) {
@@ -971,15 +1101,17 @@ namespace FEXCore::IR {
               uint32_t InterferenceNode = FindNodeToSpill(IREmit, CurrentNode, Node, OpLiveRange);
               if (InterferenceNode != ~0U) {
                 FEXCore::IR::RegisterClassType InterferenceRegClass = FEXCore::IR::RegisterClassType{uint32_t(Graph->Nodes[InterferenceNode].Head.RegAndClass >> 32)};
-                uint32_t SpillSlot = FindSpillSlot(InterferenceNode, InterferenceRegClass);
                 RegisterNode *InterferenceRegisterNode = &Graph->Nodes[InterferenceNode];
-                LogMan::Throw::A(SpillSlot != ~0U, "Interference Node doesn't have a spill slot!");
                 LogMan::Throw::A((InterferenceRegisterNode->Head.RegAndClass & ~0U) != ~0U, "Interference node never assigned a register?");
                 LogMan::Throw::A(InterferenceRegClass != ~0U, "Interference node never assigned a register class?");
                 LogMan::Throw::A(InterferenceRegisterNode->Head.PhiPartner == nullptr, "We don't support spilling PHI nodes currently");
 
                 // This is the op that we need to dump
                 auto [InterferenceOrderedNode, InterferenceIROp] = IR.at(InterferenceNode)();
+                uint32_t SpillSlot = FindSpillSlot(InterferenceIROp);
+                LogMan::Throw::A(SpillSlot != ~0U, "Interference Node doesn't have a spill slot!");
+                // Values that came from a fill are still in their slot, only the fill needs to move
+                bool AlreadyInSlot = InterferenceIROp->Op == IR::OP_FILLREGISTER;
 
 
                 // This will find the last use of this definition
@@ -987,19 +1119,22 @@ namespace FEXCore::IR {
                 // Which this is walking backwards to find the first use
                 auto LastUseIterator = FindLastUseBefore(IREmit, InterferenceOrderedNode, NodeIterator::Invalid(), IR.at(CodeNode));
                 auto [LastUseNode, LastUseIROp] = LastUseIterator();
+                auto FirstIter = LastUseIterator;
 
-                // Set the write cursor to point of last usage
-                IREmit->SetWriteCursor(LastUseNode);
+                if (!AlreadyInSlot) {
+                  // Set the write cursor to point of last usage
+                  IREmit->SetWriteCursor(LastUseNode);
 
-                // Actually spill the node now
-                auto SpillOp = IREmit->_SpillRegister(InterferenceOrderedNode, SpillSlot, InterferenceRegClass);
-                SpillOp.first->Header.Size = InterferenceIROp->Size;
-                SpillOp.first->Header.ElementSize = InterferenceIROp->ElementSize;
+                  // Actually spill the node now
+                  auto SpillOp = IREmit->_SpillRegister(InterferenceOrderedNode, SpillSlot, InterferenceRegClass);
+                  SpillOp.first->Header.Size = InterferenceIROp->Size;
+                  SpillOp.first->Header.ElementSize = InterferenceIROp->ElementSize;
+                  FirstIter = IR.at(SpillOp.Node);
+                }
 
                 {
                   // Search from the point of spilling to find the first use
                   // Set the write cursor to the first location found and fill at that point
-                  auto FirstIter = IR.at(SpillOp.Node);
                   // Just past the spill
                   ++FirstIter;
                   auto FirstUseLocation = FindFirstUse(IREmit, InterferenceOrderedNode, FirstIter, NodeIterator::Invalid());
@@ -1047,6 +1182,7 @@ namespace FEXCore::IR {
     auto IR = IREmit->ViewIR();
 
     uint32_t SSACount = IR.GetSSACount();
+    AllocatedSSACount = SSACount;
 
     ResetRegisterGraph(Graph, SSACount);
     FindNodeClasses(Graph, &IR);
@@ -1095,7 +1231,6 @@ namespace FEXCore::IR {
     }
 
     SpillSlotCount = 0;
-    Graph->SpillStack.clear();
 
     CalculatePrecessors(&IR);
 
@@ -1119,6 +1254,8 @@ namespace FEXCore::IR {
       Changed = true;
     }
 
+    AllocateSpillSlots(IREmit);
+
     return Changed;
   }
 
@@ -9,6 +9,7 @@ class IRListView;
 class RegisterAllocationPass : public FEXCore::IR::Pass {
   public:
     bool HasFullRA() const { return HadFullRA; }
+    // Size of the spill area in 8 byte slots, always a multiple of 16 bytes
     uint32_t SpillSlots() const { return SpillSlotCount; }
 
     virtual void AllocateRegisterSet(uint32_t RegisterCount, uint32_t ClassCount) = 0;
@@ -38,6 +39,14 @@ class RegisterAllocationPass : public FEXCore::IR::Pass {
      * Top 32bits is the class, lower 32bits is the register
      */
     virtual uint64_t GetNodeRegister(uint32_t Node) = 0;
+
+    /**
+     * @brief Returns the registers of every value that is live across Node, encoded like GetNodeRegister
+     *
+     * Values consumed or defined by Node itself aren't included.
+     * Backends use this to only preserve the registers that matter around a call out of the JIT.
+     */
+    virtual void GetLiveAcrossNode(uint32_t Node, std::vector<uint64_t> *Registers) = 0;
     /**  @} */
 
   protected:
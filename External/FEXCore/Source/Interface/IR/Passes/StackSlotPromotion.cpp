@@ -0,0 +1,347 @@
+#include "Interface/IR/Passes.h"
+#include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+#include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Core/X86Enums.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+  // Guests may keep live data this far below the stack pointer without adjusting it
+  constexpr int64_t RED_ZONE_SIZE = 128;
+
+  struct StackSlot {
+    int64_t Offset;
+    uint8_t Size;
+    FEXCore::IR::RegisterClassType Class;
+    FEXCore::IR::OrderedNode *Value;     ///< Last value known to be in this slot
+    FEXCore::IR::OrderedNode *StoreNode; ///< Store that nothing could have read yet. nullptr if it may have been observed
+  };
+
+  struct StackAddress {
+    FEXCore::IR::OrderedNode *Root; ///< LoadContext of the guest stack pointer this address is based on
+    int64_t Offset;
+  };
+}
+
+namespace FEXCore::IR {
+
+class StackSlotPromotion final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+
+private:
+  std::vector<StackSlot> Slots;
+  OrderedNode *Root{};
+
+  bool DecomposeAddress(IREmitter *IREmit, OrderedNodeWrapper Addr, StackAddress *Address);
+  void SetRoot(OrderedNode *NewRoot);
+  StackSlot *FindSlot(int64_t Offset);
+  void InvalidateOverlapping(int64_t Offset, uint8_t Size);
+  void ObserveOverlapping(int64_t Offset, uint8_t Size);
+  void ObserveAll();
+  OrderedNode *ForwardValue(IREmitter *IREmit, StackSlot *Slot, OrderedNode *LoadNode, uint8_t Size, RegisterClassType Class);
+
+  template<typename T>
+  bool HandleStore(IREmitter *IREmit, OrderedNode *CodeNode, T const *Op);
+  template<typename T>
+  bool HandleLoad(IREmitter *IREmit, OrderedNode *CodeNode, T const *Op);
+};
+
+bool StackSlotPromotion::DecomposeAddress(IREmitter *IREmit, OrderedNodeWrapper Addr, StackAddress *Address) {
+  int64_t Offset{};
+  bool Is32Bit{};
+  OrderedNodeWrapper Node = Addr;
+
+  // Peel off the constant adjustments that push, pop and [rsp+disp] generate
+  while (true) {
+    auto Header = IREmit->GetOpHeader(Node);
+    uint64_t Constant{};
+
+    if (Header->Op == OP_ADD && IREmit->IsValueConstant(Header->Args[1], &Constant)) {
+      Offset += Constant;
+      Node = Header->Args[0];
+    }
+    else if (Header->Op == OP_ADD && IREmit->IsValueConstant(Header->Args[0], &Constant)) {
+      Offset += Constant;
+      Node = Header->Args[1];
+    }
+    else if (Header->Op == OP_SUB && IREmit->IsValueConstant(Header->Args[1], &Constant)) {
+      Offset -= Constant;
+      Node = Header->Args[0];
+    }
+    else {
+      break;
+    }
+
+    Is32Bit |= Header->Size == 4;
+  }
+
+  auto Header = IREmit->GetOpHeader(Node);
+  if (Header->Op != OP_LOADCONTEXT) {
+    return false;
+  }
+
+  auto Op = Header->C<IROp_LoadContext>();
+  if (Op->Offset != offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSP]) ||
+      Op->Class != GPRClass) {
+    return false;
+  }
+
+  // 32bit address math wraps, keep the offsets comparable with each other
+  if (Is32Bit || Header->Size == 4) {
+    Offset = static_cast<int32_t>(Offset);
+  }
+
+  Address->Root = IREmit->UnwrapNode(Node);
+  Address->Offset = Offset;
+  return true;
+}
+
+void StackSlotPromotion::SetRoot(OrderedNode *NewRoot) {
+  // A second load of the stack pointer may still alias the first one, we can't compare offsets between them
+  if (Root != NewRoot) {
+    Slots.clear();
+    Root = NewRoot;
+  }
+}
+
+StackSlot *StackSlotPromotion::FindSlot(int64_t Offset) {
+  for (auto &Slot : Slots) {
+    if (Slot.Offset == Offset) {
+      return &Slot;
+    }
+  }
+  return nullptr;
+}
+
+void StackSlotPromotion::InvalidateOverlapping(int64_t Offset, uint8_t Size) {
+  std::erase_if(Slots, [Offset, Size](StackSlot const &Slot) {
+    return Slot.Offset < (Offset + Size) && Offset < (Slot.Offset + Slot.Size);
+  });
+}
+
+void StackSlotPromotion::ObserveOverlapping(int64_t Offset, uint8_t Size) {
+  for (auto &Slot : Slots) {
+    if (Slot.Offset < (Offset + Size) && Offset < (Slot.Offset + Slot.Size)) {
+      Slot.StoreNode = nullptr;
+    }
+  }
+}
+
+void StackSlotPromotion::ObserveAll() {
+  for (auto &Slot : Slots) {
+    Slot.StoreNode = nullptr;
+  }
+}
+
+OrderedNode *StackSlotPromotion::ForwardValue(IREmitter *IREmit, StackSlot *Slot, OrderedNode *LoadNode, uint8_t Size, RegisterClassType Class) {
+  if (Slot->Class != Class || Slot->Size < Size) {
+    return nullptr;
+  }
+
+  OrderedNode *Value = Slot->Value;
+  uint8_t ValueSize = IREmit->GetOpSize(Value);
+
+  if (Class == GPRClass) {
+    // The store may have truncated the value, the load zero extends
+    uint8_t TruncateSize = std::min(ValueSize, Size);
+    if (TruncateSize != ValueSize) {
+      IREmit->SetWriteCursor(LoadNode);
+      Value = IREmit->_Bfe(Size, TruncateSize * 8, 0, Value);
+    }
+    return Value;
+  }
+  else if (Class == FPRClass) {
+    if (Size == ValueSize) {
+      return Value;
+    }
+    else if (Size < ValueSize) {
+      IREmit->SetWriteCursor(LoadNode);
+      return IREmit->_VMov(Value, Size);
+    }
+  }
+
+  return nullptr;
+}
+
+template<typename T>
+bool StackSlotPromotion::HandleStore(IREmitter *IREmit, OrderedNode *CodeNode, T const *Op) {
+  StackAddress Address;
+  if (!Op->Offset.IsInvalid() ||
+      !DecomposeAddress(IREmit, Op->Addr, &Address)) {
+    // This could be a pointer in to the stack, forget everything we know about it
+    Slots.clear();
+    return false;
+  }
+
+  bool Changed = false;
+  SetRoot(Address.Root);
+
+  auto Slot = FindSlot(Address.Offset);
+  if (Slot && Slot->StoreNode && Slot->Size <= Op->Size) {
+    // Overwritten before anything could read it
+    IREmit->Remove(Slot->StoreNode);
+    Changed = true;
+  }
+
+  InvalidateOverlapping(Address.Offset, Op->Size);
+  Slots.emplace_back(StackSlot{Address.Offset, Op->Size, Op->Class, IREmit->UnwrapNode(Op->Value), CodeNode});
+  return Changed;
+}
+
+template<typename T>
+bool StackSlotPromotion::HandleLoad(IREmitter *IREmit, OrderedNode *CodeNode, T const *Op) {
+  StackAddress Address;
+  if (!Op->Offset.IsInvalid() ||
+      !DecomposeAddress(IREmit, Op->Addr, &Address)) {
+    // This could be reading from the stack, none of the stores are dead anymore
+    ObserveAll();
+    return false;
+  }
+
+  SetRoot(Address.Root);
+  ObserveOverlapping(Address.Offset, Op->Size);
+
+  auto Slot = FindSlot(Address.Offset);
+  if (Slot) {
+    if (auto Value = ForwardValue(IREmit, Slot, CodeNode, Op->Size, Op->Class)) {
+      IREmit->ReplaceAllUsesWith(CodeNode, Value);
+      return true;
+    }
+  }
+
+  // Remember the loaded value so later loads of the same slot can reuse it
+  bool Overlaps = std::any_of(Slots.begin(), Slots.end(), [&Address, Op](StackSlot const &Other) {
+    return Other.Offset < (Address.Offset + Op->Size) && Address.Offset < (Other.Offset + Other.Size);
+  });
+
+  if (!Overlaps) {
+    Slots.emplace_back(StackSlot{Address.Offset, Op->Size, Op->Class, CodeNode, nullptr});
+  }
+
+  return false;
+}
+
+/**
+ * @brief Promotes guest stack slots to SSA values within a block
+ *
+ * Only valid if the guest stack is private to the thread, as another thread could otherwise
+ * modify the slot between our store and load.
+ *
+ * Addresses are tracked as a constant offset from a load of the guest stack pointer, so pushes and pops
+ * that only adjust RSP by a constant keep the slots valid.
+ *
+ * eg.
+ *   %ssa5 i64 = LoadContext #0x8, #0x28, GPR
+ *   %ssa7 i64 = Sub %ssa5 i64, %ssa6 i64
+ *   (%ssa8 i64) StoreMemTSO %ssa7 i64, %ssa3 i64, %Invalid, #0x8, #0x8, GPR, SXTX, #0x1
+ *   ...
+ *   %ssa12 i64 = LoadMemTSO %ssa7 i64, %Invalid, #0x8, #0x8, GPR, SXTX, #0x1
+ * Converts to
+ *   %ssa5 i64 = LoadContext #0x8, #0x28, GPR
+ *   %ssa7 i64 = Sub %ssa5 i64, %ssa6 i64
+ *   (%ssa8 i64) StoreMemTSO %ssa7 i64, %ssa3 i64, %Invalid, #0x8, #0x8, GPR, SXTX, #0x1
+ *   ... Uses of %ssa12 now use %ssa3
+ *
+ * Stores that are fully overwritten before anything could read them are removed.
+ * When the block exits, stores that ended up below the stack pointer and its red zone are removed as well.
+ *
+ * Any memory access that isn't based on the stack pointer could alias a slot, so those are handled conservatively.
+ */
+bool StackSlotPromotion::Run(IREmitter *IREmit) {
+  bool Changed = false;
+  auto CurrentIR = IREmit->ViewIR();
+  auto OriginalWriteCursor = IREmit->GetWriteCursor();
+
+  constexpr uint32_t RSPOffset = offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSP]);
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    Slots.clear();
+    Root = nullptr;
+
+    // Where the guest stack pointer ends up, in case it was written in this block
+    bool StackPointerWritten{};
+    StackAddress StackPointer{};
+
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      switch (IROp->Op) {
+        case OP_STOREMEM:
+          Changed |= HandleStore(IREmit, CodeNode, IROp->C<IROp_StoreMem>());
+          break;
+        case OP_STOREMEMTSO:
+          Changed |= HandleStore(IREmit, CodeNode, IROp->C<IROp_StoreMemTSO>());
+          break;
+        case OP_LOADMEM:
+          Changed |= HandleLoad(IREmit, CodeNode, IROp->C<IROp_LoadMem>());
+          break;
+        case OP_LOADMEMTSO:
+          Changed |= HandleLoad(IREmit, CodeNode, IROp->C<IROp_LoadMemTSO>());
+          break;
+        case OP_VLOADMEMELEMENT:
+          ObserveAll();
+          break;
+
+        case OP_STORECONTEXT: {
+          auto Op = IROp->C<IROp_StoreContext>();
+          if (Op->Offset == RSPOffset) {
+            StackPointerWritten = true;
+            if (!DecomposeAddress(IREmit, Op->Header.Args[0], &StackPointer)) {
+              StackPointer.Root = nullptr;
+            }
+          }
+          break;
+        }
+        case OP_STORECONTEXTPAIR:
+        case OP_STORECONTEXTINDEXED:
+          // Could be writing the stack pointer
+          StackPointerWritten = true;
+          StackPointer.Root = nullptr;
+          break;
+
+        // Context and flag accesses can't touch guest memory
+        case OP_LOADCONTEXT:
+        case OP_LOADCONTEXTPAIR:
+        case OP_LOADCONTEXTINDEXED:
+        case OP_LOADFLAG:
+        case OP_STOREFLAG:
+          break;
+
+        case OP_EXITFUNCTION: {
+          OrderedNode *FinalRoot = StackPointerWritten ? StackPointer.Root : Root;
+          int64_t FinalOffset = StackPointerWritten ? StackPointer.Offset : 0;
+
+          if (Root && FinalRoot == Root) {
+            for (auto &Slot : Slots) {
+              if (Slot.StoreNode && (Slot.Offset + Slot.Size) <= (FinalOffset - RED_ZONE_SIZE)) {
+                IREmit->Remove(Slot.StoreNode);
+                Changed = true;
+              }
+            }
+          }
+
+          Slots.clear();
+          break;
+        }
+
+        default:
+          if (IR::HasSideEffects(IROp->Op)) {
+            // Calls, atomics and branches may all observe or modify the stack
+            Slots.clear();
+          }
+          break;
+      }
+    }
+  }
+
+  IREmit->SetWriteCursor(OriginalWriteCursor);
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateStackSlotPromotion() {
+  return new StackSlotPromotion{};
+}
+
+}
@@ -5,6 +5,8 @@
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/Utils/LogManager.h>
 
+#include <array>
+
 namespace FEXCore::IR {
 
 class SyscallOptimization final : public FEXCore::IR::Pass {
@@ -12,10 +14,23 @@ public:
   bool Run(IREmitter *IREmit) override;
 };
 
+/**
+ * @brief Resolves syscalls with a constant syscall number at compile time
+ *
+ * Arguments past what the syscall takes are dropped.
+ * If the frontend says guest and host agree on the syscall it becomes an InlineSyscall, which the JIT issues itself.
+ * Otherwise if the frontend has a handler function for it, it becomes a DirectSyscall that calls the handler without
+ * going through HandleSyscall's dispatch.
+ */
 bool SyscallOptimization::Run(IREmitter *IREmit) {
   bool Changed = false;
   auto CurrentIR = IREmit->ViewIR();
+  auto OriginalWriteCursor = IREmit->GetWriteCursor();
 
+  // Offline tools can run the pipeline without a syscall handler
+  if (!Manager->SyscallHandler) {
+    return false;
+  }
 
   for (auto [CodeNode, IROp] : CurrentIR.GetAllCode()) {
 
@@ -24,7 +39,6 @@ bool SyscallOptimization::Run(IREmitter *IREmit) {
       uint64_t Constant;
       if (IREmit->IsValueConstant(IROp->Args[0], &Constant)) {
         auto SyscallDef = Manager->SyscallHandler->GetSyscallABI(Constant);
-        // XXX: Once we have the ability to do real function calls then we can call directly in to the syscall handler
         if (SyscallDef.NumArgs < FEXCore::HLE::SyscallArguments::MAX_ARGS) {
           // If the number of args are less than what the IR op supports then we can remove arg usage
           // We need +1 since we are still passing in syscall number here
@@ -33,10 +47,33 @@ bool SyscallOptimization::Run(IREmitter *IREmit) {
           }
           Changed = true;
         }
+
+        if (SyscallDef.NumArgs < FEXCore::HLE::SyscallArguments::MAX_ARGS &&
+            (SyscallDef.HostSyscallNumber != -1 || SyscallDef.HandlerFunction)) {
+          std::array<OrderedNode*, FEXCore::HLE::SyscallArguments::MAX_ARGS - 1> Args;
+          for (size_t Arg = 0; Arg < Args.size(); ++Arg) {
+            Args[Arg] = Arg < SyscallDef.NumArgs ? IREmit->UnwrapNode(IROp->Args[Arg + 1]) : IREmit->Invalid();
+          }
+
+          IREmit->SetWriteCursor(CodeNode);
+          OrderedNode *Direct{};
+          if (SyscallDef.HostSyscallNumber != -1) {
+            Direct = IREmit->_InlineSyscall(Args[0], Args[1], Args[2], Args[3], Args[4], Args[5],
+              SyscallDef.HostSyscallNumber, SyscallDef.NumArgs);
+          }
+          else {
+            Direct = IREmit->_DirectSyscall(Args[0], Args[1], Args[2], Args[3], Args[4], Args[5],
+              reinterpret_cast<uintptr_t>(SyscallDef.HandlerFunction), SyscallDef.NumArgs);
+          }
+
+          IREmit->ReplaceAllUsesWith(CodeNode, Direct);
+          Changed = true;
+        }
       }
     }
   }
 
+  IREmit->SetWriteCursor(OriginalWriteCursor);
 
   return Changed;
 }
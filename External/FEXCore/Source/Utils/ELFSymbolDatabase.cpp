@@ -306,6 +306,26 @@ ELFSymbol const *ELFSymbolDatabase::GetSymbolInRange(RangeType Address) {
   return Sym->second;
 }
 
+std::string const *ELFSymbolDatabase::GetELFNameInRange(uint64_t Address, uint64_t *Base) const {
+  auto InRange = [Address](ELFInfo const *ELF) {
+    return Address >= std::get<0>(ELF->CustomLayout) && Address < std::get<1>(ELF->CustomLayout);
+  };
+
+  if (InRange(&LocalInfo)) {
+    *Base = LocalInfo.GuestBase;
+    return &LocalInfo.Name;
+  }
+
+  for (auto ELF : DynamicELFInfo) {
+    if (InRange(ELF)) {
+      *Base = ELF->GuestBase;
+      return &ELF->Name;
+    }
+  }
+
+  return nullptr;
+}
+
 void ELFSymbolDatabase::GetInitLocations(std::vector<uint64_t> *Locations) {
   // Walk the initialization order and fill the locations for initializations
   for (auto ELF : InitializationOrder) {
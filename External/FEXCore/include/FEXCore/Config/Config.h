@@ -30,6 +30,14 @@ namespace FEXCore::Config {
     CONFIG_IS_INTERPRETER,
     CONFIG_INTERPRETER_INSTALLED,
     CONFIG_APP_FILENAME,
+    CONFIG_OPT_LEVEL,
+    CONFIG_PASS_PIPELINE,
+    CONFIG_PRIVATE_STACK,
+    CONFIG_HOSTFEATURES,
+    CONFIG_JITSYMBOLS,
+    CONFIG_BLOCKPROFILE,
+    CONFIG_X87SOFTFLOAT,
+    CONFIG_INTERPRETER_SWITCH,
   };
 
   enum ConfigCore {
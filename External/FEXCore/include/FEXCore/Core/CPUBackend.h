@@ -1,4 +1,6 @@
 #pragma once
+#include <array>
+#include <atomic>
 #include <stdint.h>
 #include <string>
 
@@ -71,11 +73,33 @@ class LLVMCore;
      */
     virtual bool NeedsOpDispatch() = 0;
 
+    /**
+     * @brief Checks a host address against the code ranges the backend last published
+     *
+     * This never walks backend containers, so it is safe from a signal that
+     * interrupted the backend in the middle of swapping code buffers.
+     * Code buffers that only exist for nested signal frames aren't published and report false.
+     */
+    bool IsAddressInPublishedCode(uint64_t Address) const {
+      for (auto &Range : PublishedCode) {
+        uint64_t Base = Range.Base.load(std::memory_order_relaxed);
+        uint64_t End = Range.End.load(std::memory_order_relaxed);
+        if (Address >= Base && Address < End) {
+          return true;
+        }
+      }
+      return false;
+    }
+
     void ExecuteDispatch(FEXCore::Core::InternalThreadState *Thread) {
       DispatchPtr(Thread);
     }
 
     virtual void ClearCache() {}
+    /**
+     * @brief Drops anything the backend has cached for a single block that is being removed
+     */
+    virtual void RemoveCodeEntry(uint64_t GuestRIP) {}
     virtual void CopyNecessaryDataForCompileThread(CPUBackend *Original) {}
 
     using AsmDispatch = __attribute__((naked)) void(*)(FEXCore::Core::InternalThreadState *Thread);
@@ -84,6 +108,36 @@ class LLVMCore;
     JITCallback CallbackPtr{};
   protected:
     AsmDispatch DispatchPtr{};
+
+    enum PublishedCodeSlot {
+      PUBLISHED_CODE_INITIAL,
+      PUBLISHED_CODE_CURRENT,
+      PUBLISHED_CODE_DISPATCHER,
+      PUBLISHED_CODE_COUNT,
+    };
+
+    /**
+     * @brief Publishes a code buffer for IsAddressInPublishedCode, a null pointer retracts the slot
+     *
+     * The end is cleared first and written last, so a signal landing in between sees an empty range instead of a torn one.
+     * Buffers need to be retracted before they are freed.
+     */
+    void PublishCodeRange(PublishedCodeSlot Slot, void *Ptr, size_t Size) {
+      auto &Range = PublishedCode[Slot];
+      uint64_t Base = reinterpret_cast<uint64_t>(Ptr);
+      Range.End.store(0, std::memory_order_relaxed);
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+      Range.Base.store(Base, std::memory_order_relaxed);
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+      Range.End.store(Ptr ? Base + Size : 0, std::memory_order_relaxed);
+    }
+
+  private:
+    struct CodeRange {
+      std::atomic<uint64_t> Base{};
+      std::atomic<uint64_t> End{};
+    };
+    std::array<CodeRange, PUBLISHED_CODE_COUNT> PublishedCode{};
   };
 
 }
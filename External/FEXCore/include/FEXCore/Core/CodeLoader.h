@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <functional>
+#include <string>
 #include <vector>
 
 namespace FEXCore {
@@ -67,6 +68,13 @@ public:
   virtual uint64_t GetFinalRIP() { return ~0ULL; }
 
   virtual char const *FindSymbolNameInRange(uint64_t Address) { return nullptr; }
+
+  /**
+   * @brief Describes the guest code at Address for host profilers, eg. `libc.so.6:memcpy+0x40`
+   *
+   * @return false if the loader doesn't know what lives there
+   */
+  virtual bool GetSymbolDescription(uint64_t Address, std::string *Description) { return false; }
   virtual void GetExecveArguments(std::vector<char const*> *Args) {}
 
   virtual void GetAuxv(uint64_t& addr, uint64_t& size) {}
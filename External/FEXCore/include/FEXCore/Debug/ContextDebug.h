@@ -3,19 +3,59 @@
 #include <FEXCore/Debug/InternalThreadState.h>
 
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 namespace FEXCore::Core {
   struct RuntimeStats;
 }
 
+namespace FEXCore::IR {
+  class IREmitter;
+}
+
 namespace FEXCore::Context {
   struct Context;
 
 namespace Debug {
+  /**
+   * @brief Statistics gathered while compiling a block of IR offline
+   */
+  struct CompileStats {
+    uint64_t PassTime;     ///< Nanoseconds spent in the pass pipeline, including RA
+    uint64_t CompileTime;  ///< Nanoseconds spent in the backend emitting host code
+    uint64_t HostCodeSize; ///< Size of the emitted host code. Zero if the block wasn't JIT compiled
+    uint32_t SpillSlots;   ///< Size of the spill area RA needed for this block, in 8 byte slots
+  };
 
   void CompileRIP(FEXCore::Context::Context *CTX, uint64_t RIP);
 
+  /**
+   * @brief Runs a pass pipeline over IR that the frontend generated itself
+   *
+   * Uses the context's optimization level and core type to pick the pipeline
+   *
+   * @param CTX The context that we created
+   * @param IREmit The IR to optimize in place
+   * @param Pipeline Comma separated pass list overriding the configured pass pipeline. Empty uses the configured one
+   *
+   * @return false if the pipeline couldn't be parsed
+   */
+  bool RunPassPipeline(FEXCore::Context::Context *CTX, FEXCore::IR::IREmitter *IREmit, std::string const &Pipeline);
+
+  /**
+   * @brief Runs the configured pass pipeline over IR without a running guest, then optionally JIT compiles it
+   *
+   * Uses a private compile thread that never executes the code it generates
+   * RA only runs when the context's core is the JIT, the IR is left in its post-RA form so the caller can inspect it
+   *
+   * @param CTX The context that we created
+   * @param IREmit The IR to compile, modified in place
+   * @param JITCompile Emit host code after RA
+   * @param Stats Filled with the timings and sizes of this compilation
+   */
+  void CompileIR(FEXCore::Context::Context *CTX, FEXCore::IR::IREmitter *IREmit, bool JITCompile, CompileStats *Stats);
+
   uint64_t GetThreadCount(FEXCore::Context::Context *CTX);
   FEXCore::Core::RuntimeStats *GetRuntimeStatsForThread(FEXCore::Context::Context *CTX, uint64_t Thread);
   FEXCore::Core::CPUState GetCPUState(FEXCore::Context::Context *CTX);
@@ -6,6 +6,7 @@
 #include <FEXCore/Utils/Event.h>
 #include <map>
 #include <thread>
+#include <unordered_set>
 
 namespace FEXCore {
   class BlockCache;
@@ -30,6 +31,13 @@ namespace FEXCore::Core {
   struct RuntimeStats {
     std::atomic_uint64_t InstructionsExecuted;
     std::atomic_uint64_t BlocksCompiled;
+
+    // Code cache churn
+    std::atomic_uint64_t CodeCacheFlushes;       ///< Full flushes of the code cache
+    std::atomic_uint64_t CodeGenerationsEvicted; ///< Code cache regions recycled without a full flush
+    std::atomic_uint64_t BlocksEvicted;          ///< Blocks dropped by either of the above
+    std::atomic_uint64_t BlocksRecompiled;       ///< Blocks compiled again after being evicted
+    std::atomic_uint64_t BlockCachePagesEvicted; ///< Guest pages whose block mappings were dropped to back another page
   };
 
   struct DebugDataSubblock {
@@ -49,6 +57,7 @@ namespace FEXCore::Core {
     uint64_t GuestInstructionCount; ///< Number of guest instructions
     uint64_t TimeSpentInCode; ///< How long this code has spent time running
     uint64_t RunCount; ///< Number of times this block of code has been run
+    uint32_t ProfileIndex {~0U}; ///< Slot in the thread's block profiling counters, ~0U when not profiled
     std::vector<DebugDataSubblock> Subblocks;
   };
 
@@ -79,11 +88,14 @@ namespace FEXCore::Core {
 
     std::unordered_map<uint64_t, std::unique_ptr<FEXCore::IR::IRListView<true>>> IRLists;
     std::unordered_map<uint64_t, FEXCore::Core::DebugData> DebugData;
+    // Guest RIPs whose code was evicted, used to track recompile churn
+    std::unordered_set<uint64_t> EvictedBlocks;
 
     std::unique_ptr<FEXCore::Frontend::Decoder> FrontendDecoder;
     std::unique_ptr<FEXCore::IR::PassManager> PassManager;
 
     RuntimeStats Stats{};
+    uint64_t *BlockCounters{}; ///< Block profiling entry counts, indexed by DebugData::ProfileIndex
 
     int StatusCode{};
     FEXCore::Context::ExitReason ExitReason {FEXCore::Context::ExitReason::EXIT_WAITING};
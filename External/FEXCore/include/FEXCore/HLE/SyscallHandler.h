@@ -23,6 +23,11 @@ namespace FEXCore::HLE {
     // If the syscall has a return then it should be stored in the ABI specific syscall register
     // Linux = RAX
     bool HasReturn;
+    // Handler that can be called directly as uint64_t(Thread, Args[0..NumArgs])
+    // nullptr if calls must go through HandleSyscall
+    void *HandlerFunction;
+    // Host syscall number if the syscall can be passed straight through to the host, -1 otherwise
+    int32_t HostSyscallNumber;
   };
 
   enum class SyscallOSABI {
@@ -562,6 +562,18 @@ friend class FEXCore::IR::PassManager;
   IRPair<IROp_CodeBlock> CreateNewCodeBlock();
   void SetCurrentCodeBlock(OrderedNode *Node);
 
+  /**
+   * @brief Number of nodes allocated so far
+   *
+   * Nodes are allocated in emission order, so this marks where the nodes of whatever is emitted next start
+   */
+  uint32_t GetNodeCount() const { return ListData.Size() / sizeof(OrderedNode); }
+
+  /**
+   * @brief Whether any node allocated from @p FirstNode onwards can write guest memory
+   */
+  bool WritesGuestMemorySince(uint32_t FirstNode);
+
   protected:
     void RemoveArgUses(OrderedNode *Node);
 
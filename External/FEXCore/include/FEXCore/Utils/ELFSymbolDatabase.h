@@ -21,6 +21,13 @@ public:
   ::ELFLoader::ELFSymbol const *GetGlobalSymbolInRange(RangeType Address);
   ::ELFLoader::ELFSymbol const *GetNoWeakSymbolInRange(RangeType Address);
 
+  /**
+   * @brief Finds the ELF whose memory layout covers Address
+   *
+   * @return The ELF's name, nullptr if Address isn't in any of them. Base is where the ELF was loaded
+   */
+  std::string const *GetELFNameInRange(uint64_t Address, uint64_t *Base) const;
+
   void GetInitLocations(std::vector<uint64_t> *Locations);
 
 private:
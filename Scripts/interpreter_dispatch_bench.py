@@ -0,0 +1,52 @@
+#!/usr/bin/python3
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+# Runs the same IR file through the interpreter with threaded and with switch dispatch and reports both
+# Args: <IRLoader Executable> [IR file] [Runs]
+# The IR file defaults to InterpreterDispatch.ir next to this script
+
+if (len(sys.argv) < 2):
+    sys.exit("Usage: interpreter_dispatch_bench.py <IRLoader> [IR file] [Runs]")
+
+script_dir = os.path.dirname(os.path.abspath(__file__))
+
+runner = sys.argv[1]
+ir_file = sys.argv[2] if len(sys.argv) > 2 else os.path.join(script_dir, "InterpreterDispatch.ir")
+runs = int(sys.argv[3]) if len(sys.argv) > 3 else 10
+config_file = tempfile.NamedTemporaryFile(suffix = ".config.bin", delete = False)
+config_file.close()
+
+modes = [
+    ("threaded", []),
+    ("switch", ["--interpreter-switch"]),
+]
+
+try:
+    subprocess.run(["python3", os.path.join(script_dir, "json_ir_config_parse.py"), ir_file, config_file.name], check = True)
+
+    results = {}
+    for name, extra_args in modes:
+        times = []
+        for i in range(runs):
+            start = time.perf_counter()
+            process = subprocess.run([runner, "-c", "irint", "-n", "500"] + extra_args + [ir_file, config_file.name],
+                                     stdout = subprocess.DEVNULL, stderr = subprocess.DEVNULL)
+            end = time.perf_counter()
+            if (process.returncode != 0):
+                sys.exit("{} dispatch failed the test with {}".format(name, process.returncode))
+            times.append(end - start)
+        results[name] = times
+
+    for name, times in results.items():
+        print("{:>8}: min {:.4f}s median {:.4f}s over {} runs".format(name, min(times), statistics.median(times), len(times)))
+
+    threaded = statistics.median(results["threaded"])
+    switch = statistics.median(results["switch"])
+    print("switch / threaded: {:.3f}x".format(switch / threaded))
+finally:
+    os.unlink(config_file.name)
@@ -0,0 +1,52 @@
+#!/usr/bin/python3
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+# Times the 32bit mmap fragmentation replay through the test harness
+# The unittest stays the correctness check, this only scales up the number of rounds and reports how long they take
+# Args: <TestHarnessRunner Executable> [Rounds] [Runs] [Runner Args]...
+
+if (len(sys.argv) < 2):
+    sys.exit("Usage: mmap_fragmentation_bench.py <TestHarnessRunner> [Rounds] [Runs] [Runner Args]...")
+
+runner = sys.argv[1]
+rounds = int(sys.argv[2]) if len(sys.argv) > 2 else 256
+runs = int(sys.argv[3]) if len(sys.argv) > 3 else 10
+runner_args = sys.argv[4:] if len(sys.argv) > 4 else ["-c", "irjit", "-n", "500"]
+
+script_dir = os.path.dirname(os.path.abspath(__file__))
+asm_file = os.path.join(script_dir, "..", "unittests", "32Bit_ASM", "Syscalls", "MMap_Fragmentation.asm")
+
+temp_dir = tempfile.mkdtemp()
+
+try:
+    # Same wrapping the 32Bit_ASM tests get from their CMakeLists.txt
+    wrapped_asm = os.path.join(temp_dir, "MMap_Fragmentation.asm")
+    with open(asm_file) as src, open(wrapped_asm, "w") as dst:
+        dst.write("BITS 32\norg 10000h\n")
+        dst.write(src.read())
+        dst.write("\nret\n")
+
+    binary = os.path.join(temp_dir, "MMap_Fragmentation.bin")
+    config = os.path.join(temp_dir, "MMap_Fragmentation.config.bin")
+    subprocess.run(["nasm", "-DROUNDS={}".format(rounds), wrapped_asm, "-o", binary], check = True)
+    subprocess.run(["python3", os.path.join(script_dir, "json_asm_config_parse.py"), asm_file, config], check = True)
+
+    times = []
+    for i in range(runs):
+        start = time.perf_counter()
+        process = subprocess.run([runner] + runner_args + [binary, config],
+                                 stdout = subprocess.DEVNULL, stderr = subprocess.DEVNULL)
+        end = time.perf_counter()
+        if (process.returncode != 0):
+            sys.exit("Replay failed the test with {}".format(process.returncode))
+        times.append(end - start)
+
+    print("{} rounds: min {:.4f}s median {:.4f}s over {} runs".format(rounds, min(times), statistics.median(times), len(times)))
+finally:
+    shutil.rmtree(temp_dir)
@@ -72,6 +72,18 @@ namespace FEX::ArgLoader {
         .help("Checks code for modification before execution. Slow.")
         .set_default(false);
 
+      CPUGroup.add_option("--x87-softfloat")
+        .dest("X87SoftFloat")
+        .action("store_true")
+        .help("Emulates x87 ops with softfloat instead of the host's x87 unit. Slow, for validation.")
+        .set_default(false);
+
+      CPUGroup.add_option("--interpreter-switch")
+        .dest("InterpreterSwitch")
+        .action("store_true")
+        .help("Dispatches interpreter ops through a switch instead of threaded code. For comparing dispatch cost.")
+        .set_default(false);
+
       CPUGroup.add_option("--unsafe-no-tso")
         .dest("TSOEnabled")
         .action("store_false")
@@ -90,6 +102,28 @@ namespace FEX::ArgLoader {
         .help("Does not calculate the parity flag on integer operations")
         .set_default(false);
 
+      CPUGroup.add_option("-O", "--opt-level")
+        .dest("OptLevel")
+        .help("IR optimization level. 0 runs only DCE, 2 iterates store elimination")
+        .choices({"0", "1", "2"})
+        .set_default("1");
+
+      CPUGroup.add_option("--passes")
+        .dest("PassPipeline")
+        .help("Comma separated IR pass list. +pass/-pass adjust the opt level pipeline, bare names replace it")
+        .set_default("");
+
+      CPUGroup.add_option("--unsafe-private-stack")
+        .dest("PrivateStack")
+        .action("store_true")
+        .help("Assumes the guest stack is only accessed by its own thread. Forwards stack stores to stack loads")
+        .set_default(false);
+
+      CPUGroup.add_option("--host-features")
+        .dest("HostFeatures")
+        .help("Comma separated host CPU feature overrides, eg. disablebmi2,disablelzcnt")
+        .set_default("");
+
       Parser.add_option_group(CPUGroup);
     }
     {
@@ -154,6 +188,16 @@ namespace FEX::ArgLoader {
           .help("Folder to dump the IR [no, stdout, stderr, <Folder>]")
           .set_default("no");
 
+      LoggingGroup.add_option("--jit-symbols")
+          .dest("JITSymbols")
+          .help("Tell host profilers about JIT code [none, perfmap, jitdump]")
+          .set_default("none");
+
+      LoggingGroup.add_option("--block-profile")
+          .dest("BlockProfile")
+          .help("Profile guest blocks, written to /tmp/fex-*.folded on exit [none, counters, sampling]")
+          .set_default("none");
+
       Parser.add_option_group(LoggingGroup);
     }
 
@@ -215,6 +259,14 @@ namespace FEX::ArgLoader {
         bool SMCChecks = Options.get("SMCChecks");
         Set(FEXCore::Config::ConfigOption::CONFIG_SMC_CHECKS, std::to_string(SMCChecks));
       }
+      if (Options.is_set_by_user("X87SoftFloat")) {
+        bool X87SoftFloat = Options.get("X87SoftFloat");
+        Set(FEXCore::Config::ConfigOption::CONFIG_X87SOFTFLOAT, std::to_string(X87SoftFloat));
+      }
+      if (Options.is_set_by_user("InterpreterSwitch")) {
+        bool InterpreterSwitch = Options.get("InterpreterSwitch");
+        Set(FEXCore::Config::ConfigOption::CONFIG_INTERPRETER_SWITCH, std::to_string(InterpreterSwitch));
+      }
       if (Options.is_set_by_user("AbiLocalFlags")) {
         bool AbiLocalFlags = Options.get("AbiLocalFlags");
         Set(FEXCore::Config::ConfigOption::CONFIG_ABI_LOCAL_FLAGS, std::to_string(AbiLocalFlags));
@@ -223,6 +275,22 @@ namespace FEX::ArgLoader {
         bool AbiNoPF = Options.get("AbiNoPF");
         Set(FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF, std::to_string(AbiNoPF));
       }
+      if (Options.is_set_by_user("OptLevel")) {
+        std::string OptLevel = Options["OptLevel"];
+        Set(FEXCore::Config::ConfigOption::CONFIG_OPT_LEVEL, OptLevel);
+      }
+      if (Options.is_set_by_user("PassPipeline")) {
+        std::string PassPipeline = Options["PassPipeline"];
+        Set(FEXCore::Config::ConfigOption::CONFIG_PASS_PIPELINE, PassPipeline);
+      }
+      if (Options.is_set_by_user("PrivateStack")) {
+        bool PrivateStack = Options.get("PrivateStack");
+        Set(FEXCore::Config::ConfigOption::CONFIG_PRIVATE_STACK, std::to_string(PrivateStack));
+      }
+      if (Options.is_set_by_user("HostFeatures")) {
+        std::string HostFeatures = Options["HostFeatures"];
+        Set(FEXCore::Config::ConfigOption::CONFIG_HOSTFEATURES, HostFeatures);
+      }
     }
 
     {
@@ -265,6 +333,16 @@ namespace FEX::ArgLoader {
         std::string DumpIR = Options["DumpIR"];
         Set(FEXCore::Config::ConfigOption::CONFIG_DUMPIR, DumpIR);
       }
+
+      if (Options.is_set_by_user("JITSymbols")) {
+        std::string JITSymbols = Options["JITSymbols"];
+        Set(FEXCore::Config::ConfigOption::CONFIG_JITSYMBOLS, JITSymbols);
+      }
+
+      if (Options.is_set_by_user("BlockProfile")) {
+        std::string BlockProfile = Options["BlockProfile"];
+        Set(FEXCore::Config::ConfigOption::CONFIG_BLOCKPROFILE, BlockProfile);
+      }
     }
 
     RemainingArgs = Parser.args();
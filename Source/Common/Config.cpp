@@ -186,6 +186,14 @@ namespace FEX::Config {
     {FEXCore::Config::ConfigOption::CONFIG_SMC_CHECKS,         "SMCChecks"},
     {FEXCore::Config::ConfigOption::CONFIG_ABI_LOCAL_FLAGS,    "ABILocalFlags"},
     {FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF,          "ABINoPF"},
+    {FEXCore::Config::ConfigOption::CONFIG_OPT_LEVEL,          "OptLevel"},
+    {FEXCore::Config::ConfigOption::CONFIG_PASS_PIPELINE,      "Passes"},
+    {FEXCore::Config::ConfigOption::CONFIG_PRIVATE_STACK,      "PrivateStack"},
+    {FEXCore::Config::ConfigOption::CONFIG_HOSTFEATURES,       "HostFeatures"},
+    {FEXCore::Config::ConfigOption::CONFIG_JITSYMBOLS,         "JITSymbols"},
+    {FEXCore::Config::ConfigOption::CONFIG_BLOCKPROFILE,       "BlockProfile"},
+    {FEXCore::Config::ConfigOption::CONFIG_X87SOFTFLOAT,       "X87SoftFloat"},
+    {FEXCore::Config::ConfigOption::CONFIG_INTERPRETER_SWITCH, "InterpreterSwitch"},
   }};
 
 
@@ -232,6 +240,14 @@ namespace FEX::Config {
     {"SMCChecks",     FEXCore::Config::ConfigOption::CONFIG_SMC_CHECKS},
     {"ABILocalFlags", FEXCore::Config::ConfigOption::CONFIG_ABI_LOCAL_FLAGS},
     {"AbiNoPF",       FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF},
+    {"OptLevel",      FEXCore::Config::ConfigOption::CONFIG_OPT_LEVEL},
+    {"Passes",        FEXCore::Config::ConfigOption::CONFIG_PASS_PIPELINE},
+    {"PrivateStack",  FEXCore::Config::ConfigOption::CONFIG_PRIVATE_STACK},
+    {"HostFeatures",  FEXCore::Config::ConfigOption::CONFIG_HOSTFEATURES},
+    {"JITSymbols",    FEXCore::Config::ConfigOption::CONFIG_JITSYMBOLS},
+    {"BlockProfile",  FEXCore::Config::ConfigOption::CONFIG_BLOCKPROFILE},
+    {"X87SoftFloat",  FEXCore::Config::ConfigOption::CONFIG_X87SOFTFLOAT},
+    {"InterpreterSwitch", FEXCore::Config::ConfigOption::CONFIG_INTERPRETER_SWITCH},
   }};
 
   void OptionMapper::MapNameToOption(const char *ConfigName, const char *ConfigString) {
@@ -304,7 +320,7 @@ namespace FEX::Config {
       }
     };
 
-    static const std::array<std::pair<std::string, FEXCore::Config::ConfigOption>, 18> ConfigLookup = {{
+    static const std::array<std::pair<std::string, FEXCore::Config::ConfigOption>, 26> ConfigLookup = {{
       {"FEX_CORE",          FEXCore::Config::ConfigOption::CONFIG_DEFAULTCORE},
       {"FEX_MAXINST",       FEXCore::Config::ConfigOption::CONFIG_MAXBLOCKINST},
       {"FEX_SINGLESTEP",    FEXCore::Config::ConfigOption::CONFIG_SINGLESTEP},
@@ -323,6 +339,14 @@ namespace FEX::Config {
       {"FEX_ABINOPF",       FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF},
       {"FEX_BREAK",         FEXCore::Config::ConfigOption::CONFIG_BREAK_ON_FRONTEND},
       {"FEX_DUMP_GPRS",     FEXCore::Config::ConfigOption::CONFIG_DUMP_GPRS},
+      {"FEX_OPTLEVEL",      FEXCore::Config::ConfigOption::CONFIG_OPT_LEVEL},
+      {"FEX_PASSES",        FEXCore::Config::ConfigOption::CONFIG_PASS_PIPELINE},
+      {"FEX_PRIVATESTACK",  FEXCore::Config::ConfigOption::CONFIG_PRIVATE_STACK},
+      {"FEX_HOSTFEATURES",  FEXCore::Config::ConfigOption::CONFIG_HOSTFEATURES},
+      {"FEX_JITSYMBOLS",    FEXCore::Config::ConfigOption::CONFIG_JITSYMBOLS},
+      {"FEX_BLOCKPROFILE",  FEXCore::Config::ConfigOption::CONFIG_BLOCKPROFILE},
+      {"FEX_X87SOFTFLOAT",  FEXCore::Config::ConfigOption::CONFIG_X87SOFTFLOAT},
+      {"FEX_INTERPRETERSWITCH", FEXCore::Config::ConfigOption::CONFIG_INTERPRETER_SWITCH},
     }};
 
     std::optional<std::string_view> Value;
@@ -4,6 +4,7 @@
 #include "HarnessHelpers.h"
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/SignalDelegator.h"
+#include "Tests/LinuxSyscalls/VDSO.h"
 
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CodeLoader.h>
@@ -205,6 +206,14 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::Value<bool> SMCChecksConfig{FEXCore::Config::CONFIG_SMC_CHECKS, false};
   FEXCore::Config::Value<bool> ABILocalFlags{FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS, false};
   FEXCore::Config::Value<bool> AbiNoPF{FEXCore::Config::CONFIG_ABI_NO_PF, false};
+  FEXCore::Config::Value<uint8_t> OptLevel{FEXCore::Config::CONFIG_OPT_LEVEL, 1};
+  FEXCore::Config::Value<std::string> PassPipeline{FEXCore::Config::CONFIG_PASS_PIPELINE, ""};
+  FEXCore::Config::Value<bool> PrivateStack{FEXCore::Config::CONFIG_PRIVATE_STACK, false};
+  FEXCore::Config::Value<std::string> HostFeatures{FEXCore::Config::CONFIG_HOSTFEATURES, ""};
+  FEXCore::Config::Value<std::string> JITSymbols{FEXCore::Config::CONFIG_JITSYMBOLS, ""};
+  FEXCore::Config::Value<std::string> BlockProfile{FEXCore::Config::CONFIG_BLOCKPROFILE, ""};
+  FEXCore::Config::Value<bool> X87SoftFloat{FEXCore::Config::CONFIG_X87SOFTFLOAT, false};
+  FEXCore::Config::Value<bool> InterpreterSwitch{FEXCore::Config::CONFIG_INTERPRETER_SWITCH, false};
 
 
   ::SilentLog = SilentLog();
@@ -232,6 +241,7 @@ int main(int argc, char **argv, char **const envp) {
   }
 
   FEX::HarnessHelper::ELFCodeLoader Loader{Program, LDPath(), Args, ParsedArgs, envp, &Environment};
+  Loader.SetVDSOBase(FEX::HLE::VDSO::LoadVDSO(Loader.Is64BitMode()));
 
   FEXCore::Context::InitializeStaticTables(Loader.Is64BitMode() ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
   auto CTX = FEXCore::Context::CreateNewContext();
@@ -249,7 +259,15 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_SMC_CHECKS, SMCChecksConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS, ABILocalFlags());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ABI_NO_PF, AbiNoPF());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_OPT_LEVEL, OptLevel());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_PIPELINE, PassPipeline());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PRIVATE_STACK, PrivateStack());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOSTFEATURES, HostFeatures());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_DUMPIR, DumpIR());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_JITSYMBOLS, JITSymbols());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_BLOCKPROFILE, BlockProfile());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_X87SOFTFLOAT, X87SoftFloat());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_INTERPRETER_SWITCH, InterpreterSwitch());
   FEXCore::Config::Set(FEXCore::Config::CONFIG_APP_FILENAME, std::filesystem::canonical(Program));
   FEXCore::Config::Set(FEXCore::Config::CONFIG_IS64BIT_MODE, Loader.Is64BitMode() ? "1" : "0");
 
@@ -443,7 +443,8 @@ public:
   ELFCodeLoader(std::string const &Filename, std::string const &RootFS, [[maybe_unused]] std::vector<std::string> const &args, std::vector<std::string> const &ParsedArgs, char **const envp = nullptr, FEXCore::Config::Value<std::string> *AdditionalEnvp = nullptr)
     : File {Filename, RootFS, false}
     , DB {&File}
-    , Args {args} {
+    , Args {args}
+    , ExecutableName {Filename.substr(Filename.find_last_of('/') + 1)} {
 
     if (File.HasDynamicLinker()) {
       // If the file isn't static then we need to add the filename of interpreter
@@ -496,12 +497,12 @@ public:
       // On x86 only allows userspace to check for monitor and fs/gs base writing in CPL3
       //AuxVariables.emplace_back(auxv_t{26, 0}); // AT_HWCAP2
       AuxVariables.emplace_back(auxv_t{32, 0ULL}); // sysinfo (vDSO)
-      AuxVariables.emplace_back(auxv_t{33, 0ULL}); // sysinfo (vDSO)
+      AuxVariables.emplace_back(auxv_t{33, 0ULL}); // AT_SYSINFO_EHDR, see SetVDSOBase
     }
     else {
       AuxVariables.emplace_back(auxv_t{4, 0x20}); // AT_PHENT
       AuxVariables.emplace_back(auxv_t{32, 0ULL}); // sysinfo (vDSO)
-      AuxVariables.emplace_back(auxv_t{33, 0ULL}); // sysinfo (vDSO)
+      AuxVariables.emplace_back(auxv_t{33, 0ULL}); // AT_SYSINFO_EHDR, see SetVDSOBase
     }
 
     AuxVariables.emplace_back(auxv_t{3, DB.GetElfBase()}); // Program header
@@ -518,6 +519,19 @@ public:
     return STACK_SIZE;
   }
 
+  /**
+   * @brief Tells the guest where its vDSO image is mapped, zero leaves it without one
+   *
+   * Needs to happen before the stack is set up
+   */
+  void SetVDSOBase(uint64_t Base) {
+    for (auto &Aux : AuxVariables) {
+      if (Aux.key == 33) { // AT_SYSINFO_EHDR
+        Aux.val = Base;
+      }
+    }
+  }
+
   template <typename PointerType, typename AuxType, size_t PointerSize>
   static void SetupPointers(
     uintptr_t StackPointer,
@@ -720,6 +734,33 @@ public:
     return nullptr;
   }
 
+  bool GetSymbolDescription(uint64_t Address, std::string *Description) override {
+    ELFLoader::ELFSymbol const *Sym = DB.GetSymbolInRange(std::make_pair(Address, 1));
+    uint64_t Base{};
+    std::string const *ELFName = DB.GetELFNameInRange(Address, &Base);
+
+    if (!Sym && !ELFName) {
+      return false;
+    }
+
+    std::string Lib;
+    if (ELFName) {
+      // The main executable is only known by its /proc path in the database
+      Lib = *ELFName == "/proc/self/exe" ? ExecutableName : ELFName->substr(ELFName->find_last_of('/') + 1);
+    }
+
+    char Offset[32];
+    if (Sym) {
+      snprintf(Offset, sizeof(Offset), "+0x%lx", Address - Sym->Address);
+      *Description = ELFName ? Lib + ":" + Sym->Name + Offset : std::string(Sym->Name) + Offset;
+    }
+    else {
+      snprintf(Offset, sizeof(Offset), "+0x%lx", Address - Base);
+      *Description = Lib + Offset;
+    }
+    return true;
+  }
+
   void GetInitLocations(std::vector<uint64_t> *Locations) override {
     DB.GetInitLocations(Locations);
   }
@@ -737,6 +778,7 @@ private:
   ::ELFLoader::ELFContainer File;
   ::ELFLoader::ELFSymbolDatabase DB;
   std::vector<std::string> Args;
+  std::string ExecutableName;
   std::vector<std::string> EnvironmentVariables;
   std::vector<char const*> LoaderArgs;
   struct auxv32_t {
@@ -104,6 +104,11 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::Value<bool> MultiblockConfig{FEXCore::Config::CONFIG_MULTIBLOCK, false};
   FEXCore::Config::Value<bool> GdbServerConfig{FEXCore::Config::CONFIG_GDBSERVER, false};
   FEXCore::Config::Value<std::string> LDPath{FEXCore::Config::CONFIG_ROOTFSPATH, ""};
+  FEXCore::Config::Value<uint8_t> OptLevel{FEXCore::Config::CONFIG_OPT_LEVEL, 1};
+  FEXCore::Config::Value<std::string> PassPipeline{FEXCore::Config::CONFIG_PASS_PIPELINE, ""};
+  FEXCore::Config::Value<bool> PrivateStack{FEXCore::Config::CONFIG_PRIVATE_STACK, false};
+  FEXCore::Config::Value<std::string> HostFeatures{FEXCore::Config::CONFIG_HOSTFEATURES, ""};
+  FEXCore::Config::Value<bool> InterpreterSwitch{FEXCore::Config::CONFIG_INTERPRETER_SWITCH, false};
 
   auto Args = FEX::ArgLoader::Get();
   auto ParsedArgs = FEX::ArgLoader::GetParsedArgs();
@@ -120,6 +125,11 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_MAXBLOCKINST, BlockSizeConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_GDBSERVER, GdbServerConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ROOTFSPATH, LDPath());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_OPT_LEVEL, OptLevel());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_PIPELINE, PassPipeline());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PRIVATE_STACK, PrivateStack());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOSTFEATURES, HostFeatures());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_INTERPRETER_SWITCH, InterpreterSwitch());
   std::unique_ptr<FEX::HLE::SignalDelegator> SignalDelegation = std::make_unique<FEX::HLE::SignalDelegator>();
 
   FEXCore::Context::SetSignalDelegator(CTX, SignalDelegation.get());
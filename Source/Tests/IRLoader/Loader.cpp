@@ -177,7 +177,11 @@ namespace FEX::IRLoader {
   }
 
   Loader::Loader(std::string const &Filename, std::string const &ConfigFilename) {
-    Config.Init(ConfigFilename);
+    // Offline tools only want the IR, they don't run it against a test config
+    if (!ConfigFilename.empty()) {
+      Config.Init(ConfigFilename);
+    }
+
     std::fstream fp(Filename, std::fstream::binary | std::fstream::in);
 
     if (!fp.is_open()) {
@@ -202,6 +206,12 @@ namespace FEX::IRLoader {
     Loaded = Parse();
   }
 
+  Loader::Loader(std::vector<std::string> IRLines)
+    : Lines {std::move(IRLines)} {
+		ResetWorkingList();
+    Loaded = Parse();
+  }
+
 	bool Loader::Parse() {
     auto CheckPrintError = [&](LineDefinition &Def, DecodeFailure Failure) -> bool {
       if (Failure != DecodeFailure::DECODE_OKAY) {
@@ -32,6 +32,7 @@ namespace FEX::IRLoader {
   class Loader final : public FEXCore::IR::IREmitter {
     public:
       Loader(std::string const &Filename, std::string const &ConfigFilename);
+      explicit Loader(std::vector<std::string> IRLines);
 
 			bool IsValid() const { return Loaded; }
       uint64_t GetEntryRIP() const { return EntryRIP; }
@@ -1,4 +1,8 @@
+#include <fcntl.h>
 #include <filesystem>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <FEXCore/Utils/LogManager.h>
 #include "FEXCore/Core/CodeLoader.h"
@@ -573,78 +577,181 @@ namespace FEX::EmulatedFile {
     return cpu_stream.str();
   }
 
+  // Seals are what let every open share the one copy of the contents
+  static int32_t CreateSealedFile(std::string const &Contents) {
+    int32_t FD = memfd_create("FEXEmulatedFile", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (FD == -1) {
+      return -1;
+    }
+
+    size_t Written = 0;
+    while (Written < Contents.size()) {
+      ssize_t Result = write(FD, Contents.data() + Written, Contents.size() - Written);
+      if (Result == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        close(FD);
+        return -1;
+      }
+      Written += Result;
+    }
+
+    if (fcntl(FD, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == -1) {
+      close(FD);
+      return -1;
+    }
+    return FD;
+  }
+
   EmulatedFDManager::EmulatedFDManager(FEXCore::Context::Context *ctx)
     : CTX {ctx} {
-    EmulatedMap.emplace("/proc/cpuinfo");
-    EmulatedMap.emplace("/sys/devices/system/cpu/online");
-
-    FDReadCreators["/proc/cpuinfo"] = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      FILE *fp = tmpfile();
-      fwrite((void*)&cpu_info.at(0), sizeof(uint8_t), cpu_info.size(), fp);
-      fseek(fp, 0, SEEK_SET);
-      int32_t f = fileno(fp);
-      return f;
+    auto CPUInfo = [](FEXCore::Context::Context *ctx) -> std::string {
+      FEXCore::Config::Value<uint64_t> ThreadsConfig{FEXCore::Config::CONFIG_EMULATED_CPU_CORES, 1};
+      return GenerateCPUInfo(ctx, ThreadsConfig());
     };
-    auto NumCPUCores = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      FILE *fp = tmpfile();
-      fwrite((void*)&cpus_online.at(0), sizeof(uint8_t), cpus_online.size(), fp);
-      fseek(fp, 0, SEEK_SET);
-      int32_t f = fileno(fp);
-      return f;
+
+    auto NumCPUCores = [](FEXCore::Context::Context *ctx) -> std::string {
+      FEXCore::Config::Value<uint64_t> ThreadsConfig{FEXCore::Config::CONFIG_EMULATED_CPU_CORES, 1};
+      string cpus_online = "0";
+      uint64_t CPUCores = ThreadsConfig();
+      if (CPUCores > 1) {
+        cpus_online += "-" + std::to_string(CPUCores - 1);
+      }
+      return cpus_online;
     };
 
-    FDReadCreators["/sys/devices/system/cpu/online"] = NumCPUCores;
-    FDReadCreators["/sys/devices/system/cpu/present"] = NumCPUCores;
+    Files.emplace_back(CachedFile{CPUInfo, true});
+    PathTable.emplace("/proc/cpuinfo", Files.size() - 1);
 
-    string procAuxv = string("/proc/") + std::to_string(getpid()) + string("/auxv");
-    EmulatedMap.emplace(procAuxv);
-    EmulatedMap.emplace("/proc/self/auxv");
+    Files.emplace_back(CachedFile{NumCPUCores, true});
+    PathTable.emplace("/sys/devices/system/cpu/online", Files.size() - 1);
+    PathTable.emplace("/sys/devices/system/cpu/present", Files.size() - 1);
 
-    FDReadCreators[procAuxv] = &EmulatedFDManager::ProcAuxv;
-    FDReadCreators["/proc/self/auxv"] = &EmulatedFDManager::ProcAuxv;
+    ProcAuxvPath = string("/proc/") + std::to_string(getpid()) + string("/auxv");
+    Files.emplace_back(CachedFile{&EmulatedFDManager::ProcAuxv, false});
+    PathTable.emplace(ProcAuxvPath, Files.size() - 1);
+    PathTable.emplace("/proc/self/auxv", Files.size() - 1);
 
-    cpus_online = "0";
-    uint64_t CPUCores = ThreadsConfig();
-    if (CPUCores > 1) {
-      cpus_online += "-" + std::to_string(CPUCores - 1);
+    CachedCPUCores = FEXCore::Config::Value<uint64_t>{FEXCore::Config::CONFIG_EMULATED_CPU_CORES, 1}();
+  }
+
+  EmulatedFDManager::~EmulatedFDManager() {
+    for (auto &File : Files) {
+      if (File.FD != -1 && IsCachedFD(File, File.FD)) {
+        close(File.FD);
+      }
     }
+  }
 
-    cpu_info = GenerateCPUInfo(ctx, CPUCores);
+  bool EmulatedFDManager::IsCachedFD(CachedFile const &File, int32_t FD) {
+    struct stat Buffer;
+    return fstat(FD, &Buffer) == 0 &&
+           Buffer.st_dev == File.Dev &&
+           Buffer.st_ino == File.Inode;
   }
 
-  EmulatedFDManager::~EmulatedFDManager() {
+  int32_t EmulatedFDManager::ReopenCachedFile(CachedFile const &File, int flags) {
+    // A dup would share the file offset, reopening through procfs gives this open its own
+    char Path[32];
+    snprintf(Path, sizeof(Path), "/proc/self/fd/%d", File.FD);
+    int32_t FD = open(Path, O_RDONLY | (flags & O_CLOEXEC));
+    if (FD == -1) {
+      return -1;
+    }
+
+    // Checked on what was opened, so a guest swapping the fd out at any point can't hand it something else
+    if (!IsCachedFD(File, FD)) {
+      close(FD);
+      return -1;
+    }
+
+    return FD;
   }
 
   int32_t EmulatedFDManager::OpenAt(int dirfs, const char *pathname, int flags, uint32_t mode) {
+    // Guests almost always open these by their plain name, which skips resolving the path entirely
+    auto it = PathTable.find(pathname);
+    if (it != PathTable.end()) {
+      return OpenCachedFile(it->second, flags);
+    }
+
     std::error_code ec;
     bool exists = std::filesystem::exists(pathname, ec);
     if (ec) {
       return -1;
     }
-    string cpath = exists ? std::filesystem::canonical(pathname)
+    string cpath = exists ? std::filesystem::canonical(pathname, ec)
       : std::filesystem::path(pathname).lexically_normal(); // *Note: this doesn't transform to absolute
+    if (ec) {
+      return -1;
+    }
+
+    it = PathTable.find(cpath);
+    if (it == PathTable.end()) {
+      return -1;
+    }
+
+    return OpenCachedFile(it->second, flags);
+  }
+
+  int32_t EmulatedFDManager::OpenCachedFile(size_t Index, int flags) {
+    std::lock_guard<std::mutex> lk(CacheMutex);
+
+    uint64_t CPUCores = FEXCore::Config::Value<uint64_t>{FEXCore::Config::CONFIG_EMULATED_CPU_CORES, 1}();
+    if (CPUCores != CachedCPUCores) {
+      for (auto &File : Files) {
+        if (File.DependsOnCPUCores && File.FD != -1) {
+          if (IsCachedFD(File, File.FD)) {
+            close(File.FD);
+          }
+          File.FD = -1;
+        }
+      }
+      CachedCPUCores = CPUCores;
+    }
 
-    if (EmulatedMap.find(cpath) == EmulatedMap.end()) {
+    auto &File = Files[Index];
+    if (File.FD != -1) {
+      int32_t FD = ReopenCachedFile(File, flags);
+      if (FD != -1) {
+        return FD;
+      }
+
+      // The guest closed our fd or put something else there, either way it isn't ours to close any more
+      File.FD = -1;
+    }
+
+    auto Contents = File.Generate(CTX);
+    if (Contents.empty()) {
+      return -1;
+    }
+
+    File.FD = CreateSealedFile(Contents);
+    if (File.FD == -1) {
+      return -1;
+    }
+
+    struct stat Buffer;
+    if (fstat(File.FD, &Buffer) == -1) {
+      close(File.FD);
+      File.FD = -1;
       return -1;
     }
+    File.Dev = Buffer.st_dev;
+    File.Inode = Buffer.st_ino;
 
-    return FDReadCreators[cpath](CTX, dirfs, pathname, flags, mode);
+    return ReopenCachedFile(File, flags);
   }
 
-  int32_t EmulatedFDManager::ProcAuxv(FEXCore::Context::Context* ctx, int32_t fd, const char* pathname, int32_t flags, mode_t mode)
-  {
+  std::string EmulatedFDManager::ProcAuxv(FEXCore::Context::Context* ctx) {
     uint64_t auxvBase=0, auxvSize=0;
     FEX::HLE::_SyscallHandler->GetCodeLoader()->GetAuxv(auxvBase, auxvSize);
     if (!auxvBase) {
       LogMan::Msg::D("Failed to get Auxv stack address");
-      return -1;
+      return {};
     }
 
-    FILE* fp = tmpfile();
-    fwrite((void*)auxvBase, 1, auxvSize, fp);
-    fseek(fp, 0, SEEK_SET);
-    int32_t f = fileno(fp);
-    return f;
+    return std::string(reinterpret_cast<const char*>(auxvBase), auxvSize);
   }
 }
-
@@ -3,9 +3,11 @@
 
 #include <cstdint>
 #include <functional>
+#include <mutex>
 #include <unordered_map>
-#include <unordered_set>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace FEXCore {
   class FD;
@@ -23,13 +25,43 @@ namespace FEX::EmulatedFile {
 
     private:
       FEXCore::Context::Context *CTX;
-      std::string cpus_online{};
-      std::string cpu_info{};
-      using FDReadStringFunc = std::function<int32_t(FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode)>;
-      std::unordered_set<std::string> EmulatedMap;
-      std::unordered_map<std::string, FDReadStringFunc> FDReadCreators;
-
-      static int32_t ProcAuxv(FEXCore::Context::Context* ctx, int32_t fd, const char* pathname, int32_t flags, mode_t mode);
-      FEXCore::Config::Value<uint64_t> ThreadsConfig{FEXCore::Config::CONFIG_EMULATED_CPU_CORES, 1};
+
+      // Returns the file's contents, empty if they can't be generated yet
+      using FDContentsFunc = std::function<std::string(FEXCore::Context::Context *ctx)>;
+
+      /**
+       * @brief Generated contents are written once in to a sealed memfd
+       *
+       * Every open gets its own file description of that memfd, so guests don't share file offsets
+       * and nothing is regenerated or copied per open.
+       * The memfd lives in the guest's fd table, which the guest can close or dup2 over. Its identity is kept so
+       * a reused number is noticed and the contents are regenerated instead of handing out the guest's file.
+       */
+      struct CachedFile {
+        FDContentsFunc Generate;
+        // Regenerated when the emulated core count changes
+        bool DependsOnCPUCores;
+        int32_t FD{-1};
+        uint64_t Dev{};
+        uint64_t Inode{};
+      };
+
+      std::vector<CachedFile> Files;
+      // Keys point at string literals or ProcAuxvPath, so looking up a guest path doesn't allocate
+      std::unordered_map<std::string_view, size_t> PathTable;
+      std::string ProcAuxvPath;
+
+      std::mutex CacheMutex;
+      uint64_t CachedCPUCores{};
+
+      int32_t OpenCachedFile(size_t Index, int flags);
+
+      /**
+       * @brief Returns a new file description of the cached memfd, -1 if the fd no longer is that memfd
+       */
+      static int32_t ReopenCachedFile(CachedFile const &File, int flags);
+      static bool IsCachedFD(CachedFile const &File, int32_t FD);
+
+      static std::string ProcAuxv(FEXCore::Context::Context* ctx);
   };
 }
@@ -2,7 +2,9 @@
 
 #include <FEXCore/Utils/LogManager.h>
 #include <cstring>
+#include <errno.h>
 #include <fcntl.h>
+#include <mutex>
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
 #include <sys/mman.h>
@@ -26,21 +28,80 @@ FileManager::FileManager(FEXCore::Context::Context *ctx)
     snprintf(buf, 50, "/proc/%i/exe", pid);
 
     PidSelfPath = std::string(buf);
+
+    RootFSPath = LDPath();
+    while (!RootFSPath.empty() && RootFSPath.back() == '/') {
+      RootFSPath.pop_back();
+    }
 }
 
 FileManager::~FileManager() {
 }
 
-std::string FileManager::GetEmulatedPath(const char *pathname) {
-  auto RootFSPath = LDPath();
-  if (pathname[0] != '/' ||
-      RootFSPath.empty()) {
+std::string FileManager::GetRootFSPath(const char *pathname) const {
+  if (RootFSPath.empty() ||
+      pathname[0] != '/') {
     return {};
   }
 
   return RootFSPath + pathname;
 }
 
+std::string FileManager::GetEmulatedPath(const char *pathname) {
+  auto Path = GetRootFSPath(pathname);
+  if (Path.empty()) {
+    return Path;
+  }
+
+  uint64_t Generation;
+  {
+    std::shared_lock<std::shared_mutex> lk(RootFSCacheMutex);
+    auto it = RootFSCache.find(pathname);
+    if (it != RootFSCache.end()) {
+      return it->second ? Path : std::string{};
+    }
+    Generation = RootFSCacheGeneration;
+  }
+
+  // The callers still fall back to the host path if the RootFS one fails, the cache only skips known misses
+  bool Exists = true;
+  struct stat Buffer;
+  int SavedErrno = errno;
+  if (::lstat(Path.c_str(), &Buffer) == -1) {
+    bool Missing = errno == ENOENT || errno == ENOTDIR;
+    errno = SavedErrno;
+    if (!Missing) {
+      // Something like a permission error, let the caller find out
+      return Path;
+    }
+    Exists = false;
+  }
+
+  std::unique_lock<std::shared_mutex> lk(RootFSCacheMutex);
+  // Don't cache a result that raced with an invalidation
+  if (Generation == RootFSCacheGeneration) {
+    if (RootFSCache.size() >= MAX_ROOTFS_CACHE_ENTRIES) {
+      RootFSCache.clear();
+    }
+    RootFSCache.emplace(pathname, Exists);
+  }
+
+  return Exists ? Path : std::string{};
+}
+
+void FileManager::InvalidateRootFSCache() {
+  if (RootFSPath.empty()) {
+    return;
+  }
+
+  // Entries are keyed on the guest's spelling of a path, so one change can be visible through any number of them.
+  // `//lib/x`, `/lib/./x` or `/lib/x` through a `/lib -> usr/lib` symlink all name `/usr/lib/x`.
+  // Working out which entries alias would cost the lookups the cache is there to save, so everything goes.
+  std::unique_lock<std::shared_mutex> lk(RootFSCacheMutex);
+  ++RootFSCacheGeneration;
+  RootFSCache.clear();
+}
+
 uint64_t FileManager::Open(const char *pathname, [[maybe_unused]] int flags, [[maybe_unused]] uint32_t mode) {
   return ::open(pathname, flags, mode);
 }
@@ -143,13 +204,18 @@ uint64_t FileManager::Openat([[maybe_unused]] int dirfs, const char *pathname, i
 
   fd = EmuFD.OpenAt(dirfs, pathname, flags, mode);
   if (fd == -1) {
-    auto Path = GetEmulatedPath(pathname);
+    // Creating could make a cached miss stale, so that always tries the RootFS
+    bool Creating = flags & O_CREAT;
+    auto Path = Creating ? GetRootFSPath(pathname) : GetEmulatedPath(pathname);
     if (!Path.empty()) {
       fd = ::openat(dirfs, Path.c_str(), flags, mode);
     }
 
     if (fd == -1)
       fd = ::openat(dirfs, pathname, flags, mode);
+
+    if (fd != -1 && Creating)
+      InvalidateRootFSCache();
   }
 
   if (fd != -1)
@@ -169,13 +235,18 @@ uint64_t FileManager::Statx(int dirfd, const char *pathname, int flags, uint32_t
 }
 
 uint64_t FileManager::Mknod(const char *pathname, mode_t mode, dev_t dev) {
-  auto Path = GetEmulatedPath(pathname);
+  uint64_t Result = -1;
+  auto Path = GetRootFSPath(pathname);
   if (!Path.empty()) {
-    uint64_t Result = ::mknod(Path.c_str(), mode, dev);
-    if (Result != -1)
-      return Result;
+    Result = ::mknod(Path.c_str(), mode, dev);
   }
-  return ::mknod(pathname, mode, dev);
+
+  if (Result == -1)
+    Result = ::mknod(pathname, mode, dev);
+
+  if (Result != -1)
+    InvalidateRootFSCache();
+  return Result;
 }
 
 uint64_t FileManager::Statfs(const char *path, void *buf) {
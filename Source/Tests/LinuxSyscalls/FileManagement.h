@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -40,11 +41,38 @@ public:
 
   std::string *FindFDName(int fd);
 
+  /**
+   * @brief Drops every cached RootFS lookup since a guest namespace change could have made any of them stale
+   *
+   * Needs to be called after anything that creates, removes or renames a path succeeds
+   */
+  void InvalidateRootFSCache();
+
 private:
   FEX::EmulatedFile::EmulatedFDManager EmuFD;
 
   std::unordered_map<int32_t, std::string> FDToNameMap;
   std::string PidSelfPath;
+
+  // Bounds the memory a guest probing lots of unique paths can pin, a full cache just starts over
+  static constexpr size_t MAX_ROOTFS_CACHE_ENTRIES = 16384;
+
+  std::string RootFSPath;
+
+  // Guest absolute path to whether it exists in the RootFS
+  // Misses are cached as well so probes that only exist on the host don't try the RootFS first every time
+  std::shared_mutex RootFSCacheMutex;
+  std::unordered_map<std::string, bool> RootFSCache;
+  uint64_t RootFSCacheGeneration {};
+
+  /**
+   * @brief Returns the guest path inside the RootFS, empty if it can't be in the RootFS
+   */
+  std::string GetRootFSPath(const char *pathname) const;
+
+  /**
+   * @brief Same as GetRootFSPath but also empty if the cache knows the path isn't in the RootFS
+   */
   std::string GetEmulatedPath(const char *pathname);
 
   FEXCore::Config::Value<std::string> Filename{FEXCore::Config::CONFIG_APP_FILENAME, ""};
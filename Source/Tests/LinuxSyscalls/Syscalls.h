@@ -72,6 +72,8 @@ public:
       SyscallPtrArg5 Ptr5;
       SyscallPtrArg6 Ptr6;
     };
+    // Set when guest and host agree on this syscall completely, so JIT code can issue it itself
+    int32_t HostSyscallNumber{-1};
 #ifdef DEBUG_STRACE
     std::string StraceFmt;
 #endif
@@ -83,7 +85,14 @@ public:
 
   FEXCore::HLE::SyscallABI GetSyscallABI(uint64_t Syscall) override {
     auto &Def = Definitions.at(Syscall);
-    return {Def.NumArgs, true};
+#ifdef DEBUG_STRACE
+    // Everything needs to go through HandleSyscall to be traced
+    return {Def.NumArgs, true, nullptr, -1};
+#else
+    // Missing syscalls take the syscall number instead of arguments
+    void *HandlerFunction = Def.NumArgs <= 6 ? Def.Ptr : nullptr;
+    return {Def.NumArgs, true, HandlerFunction, Def.HostSyscallNumber};
+#endif
   }
 
   uint64_t HandleBRK(FEXCore::Core::InternalThreadState *Thread, void *Addr);
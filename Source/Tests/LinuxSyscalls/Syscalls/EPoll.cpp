@@ -2,10 +2,80 @@
 #include "Tests/LinuxSyscalls/x64/Syscalls.h"
 #include "Tests/LinuxSyscalls/x32/Syscalls.h"
 
+#include <cstring>
 #include <stdint.h>
 #include <sys/epoll.h>
 
 namespace FEX::HLE {
+  // x86 packs epoll_event for both 32bit and 64bit guests, so data sits directly after the event mask
+  // Other hosts naturally align data, which makes their structure four bytes larger
+  struct __attribute__((packed)) epoll_event_x86 {
+    uint32_t events;
+    uint64_t data;
+  };
+  static_assert(sizeof(epoll_event_x86) == 12, "Guest epoll_event is the wrong size");
+
+  // io_uring's IORING_OP_EPOLL_CTL carries a pointer to one of these in its submission queue entry
+  // The kernel reads that entry straight out of the guest's ring, so the event never passes through here to be widened
+  // On hosts without the matching layout a 64bit guest's data field gets misread there, 32bit guests don't get io_uring at all
+
+  template<typename HostEvent>
+  static constexpr bool EPOLL_MATCHING_LAYOUT = sizeof(HostEvent) == sizeof(epoll_event_x86);
+
+  /**
+   * @brief Runs a host epoll wait on the guest's event buffer
+   *
+   * With a matching layout the host fills the guest's buffer directly.
+   * Otherwise the host is only given as many of its larger events as fit in the guest's buffer, and they are then
+   * narrowed in place front to back. A guest entry never reaches past the host entry it was read from, so nothing
+   * is clobbered before it has been read. Returning fewer events than asked for is fine, anything not returned stays queued.
+   */
+  template<typename HostEvent, typename WaitFn>
+  static uint64_t EpollWaitGuest(void *events, int maxevents, WaitFn Wait) {
+    if constexpr (EPOLL_MATCHING_LAYOUT<HostEvent>) {
+      uint64_t Result = Wait(reinterpret_cast<HostEvent*>(events), maxevents);
+      SYSCALL_ERRNO();
+    }
+
+    if (maxevents <= 0) {
+      return -EINVAL;
+    }
+
+    auto Guest = reinterpret_cast<epoll_event_x86*>(events);
+    int HostMax = static_cast<uint64_t>(maxevents) * sizeof(epoll_event_x86) / sizeof(HostEvent);
+
+    // Not enough room for even one host event, so take a single one through the stack
+    HostEvent Single{};
+    auto HostEvents = HostMax ? reinterpret_cast<HostEvent*>(events) : &Single;
+
+    int Result = Wait(HostEvents, HostMax ? HostMax : 1);
+    if (Result == -1) {
+      return -errno;
+    }
+
+    // The guest buffer only has the guest's alignment, so host events are read through memcpy
+    for (int i = 0; i < Result; ++i) {
+      HostEvent Host;
+      memcpy(&Host, &HostEvents[i], sizeof(Host));
+      epoll_event_x86 Event{Host.events, Host.data.u64};
+      memcpy(&Guest[i], &Event, sizeof(Event));
+    }
+
+    return Result;
+  }
+
+  // The epoll_event of hosts that naturally align data
+  // x86 hosts only ever take the matching path, this keeps the narrowing one building and type checked there as well
+  struct epoll_event_aligned {
+    uint32_t events;
+    union {
+      uint64_t u64;
+    } data;
+  };
+  static_assert(sizeof(epoll_event_aligned) == 16, "Aligned epoll_event is the wrong size");
+  static_assert(!EPOLL_MATCHING_LAYOUT<epoll_event_aligned>, "Aligned epoll_event needs to take the narrowing path");
+  template uint64_t EpollWaitGuest<epoll_event_aligned>(void *events, int maxevents, int (*Wait)(epoll_event_aligned *HostEvents, int HostMax));
+
   void RegisterEpoll() {
 
     REGISTER_SYSCALL_IMPL(epoll_create, [](FEXCore::Core::InternalThreadState *Thread, int size) -> uint64_t {
@@ -14,23 +84,41 @@ namespace FEX::HLE {
     });
 
     REGISTER_SYSCALL_IMPL(epoll_wait, [](FEXCore::Core::InternalThreadState *Thread, int epfd, void *events, int maxevents, int timeout) -> uint64_t {
-      uint64_t Result = epoll_wait(epfd, reinterpret_cast<struct epoll_event*>(events), maxevents, timeout);
-      SYSCALL_ERRNO();
+      return EpollWaitGuest<epoll_event>(events, maxevents, [&](epoll_event *HostEvents, int HostMax) {
+        return epoll_wait(epfd, HostEvents, HostMax, timeout);
+      });
     });
 
     REGISTER_SYSCALL_IMPL(epoll_ctl, [](FEXCore::Core::InternalThreadState *Thread, int epfd, int op, int fd, void *event) -> uint64_t {
-      uint64_t Result = epoll_ctl(epfd, op, fd, reinterpret_cast<struct epoll_event*>(event));
+      if constexpr (EPOLL_MATCHING_LAYOUT<epoll_event>) {
+        uint64_t Result = epoll_ctl(epfd, op, fd, reinterpret_cast<struct epoll_event*>(event));
+        SYSCALL_ERRNO();
+      }
+
+      // EPOLL_CTL_DEL is allowed to pass a null event
+      epoll_event HostEvent{};
+      epoll_event *HostEventPtr{};
+      if (event) {
+        epoll_event_x86 Guest;
+        memcpy(&Guest, event, sizeof(Guest));
+        HostEvent.events = Guest.events;
+        HostEvent.data.u64 = Guest.data;
+        HostEventPtr = &HostEvent;
+      }
+
+      uint64_t Result = epoll_ctl(epfd, op, fd, HostEventPtr);
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(epoll_pwait, [](FEXCore::Core::InternalThreadState *Thread, int epfd, void *events, int maxevent, int timeout, const void* sigmask) -> uint64_t {
-      uint64_t Result = epoll_pwait(
-        epfd,
-        reinterpret_cast<struct epoll_event*>(events),
-        maxevent,
-        timeout,
-        reinterpret_cast<const sigset_t*>(sigmask));
-      SYSCALL_ERRNO();
+      return EpollWaitGuest<epoll_event>(events, maxevent, [&](epoll_event *HostEvents, int HostMax) {
+        return epoll_pwait(
+          epfd,
+          HostEvents,
+          HostMax,
+          timeout,
+          reinterpret_cast<const sigset_t*>(sigmask));
+      });
     });
 
     REGISTER_SYSCALL_IMPL(epoll_create1, [](FEXCore::Core::InternalThreadState *Thread, int flags) -> uint64_t {
@@ -185,11 +185,17 @@ namespace FEX::HLE {
 
     REGISTER_SYSCALL_IMPL(mkdirat, [](FEXCore::Core::InternalThreadState *Thread, int dirfd, const char *pathname, mode_t mode) -> uint64_t {
       uint64_t Result = ::mkdirat(dirfd, pathname, mode);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(mknodat, [](FEXCore::Core::InternalThreadState *Thread, int dirfd, const char *pathname, mode_t mode, dev_t dev) -> uint64_t {
       uint64_t Result = ::mknodat(dirfd, pathname, mode, dev);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
@@ -200,21 +206,33 @@ namespace FEX::HLE {
 
     REGISTER_SYSCALL_IMPL(unlinkat, [](FEXCore::Core::InternalThreadState *Thread, int dirfd, const char *pathname, int flags) -> uint64_t {
       uint64_t Result = ::unlinkat(dirfd, pathname, flags);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(renameat, [](FEXCore::Core::InternalThreadState *Thread, int olddirfd, const char *oldpath, int newdirfd, const char *newpath) -> uint64_t {
       uint64_t Result = ::renameat(olddirfd, oldpath, newdirfd, newpath);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(linkat, [](FEXCore::Core::InternalThreadState *Thread, int olddirfd, const char *oldpath, int newdirfd, const char *newpath, int flags) -> uint64_t {
       uint64_t Result = ::linkat(olddirfd, oldpath, newdirfd, newpath, flags);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(symlinkat, [](FEXCore::Core::InternalThreadState *Thread, const char *target, int newdirfd, const char *linkpath) -> uint64_t {
       uint64_t Result = ::symlinkat(target, newdirfd, linkpath);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
@@ -282,6 +300,9 @@ namespace FEX::HLE {
 
     REGISTER_SYSCALL_IMPL(renameat2, [](FEXCore::Core::InternalThreadState *Thread, int olddirfd, const char *oldpath, int newdirfd, const char *newpath, unsigned int flags) -> uint64_t {
       uint64_t Result = ::renameat2(olddirfd, oldpath, newdirfd, newpath, flags);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
@@ -33,31 +33,49 @@ namespace FEX::HLE {
 
     REGISTER_SYSCALL_IMPL(rename, [](FEXCore::Core::InternalThreadState *Thread, const char *oldpath, const char *newpath) -> uint64_t {
       uint64_t Result = ::rename(oldpath, newpath);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(mkdir, [](FEXCore::Core::InternalThreadState *Thread, const char *pathname, mode_t mode) -> uint64_t {
       uint64_t Result = ::mkdir(pathname, mode);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(rmdir, [](FEXCore::Core::InternalThreadState *Thread, const char *pathname) -> uint64_t {
       uint64_t Result = ::rmdir(pathname);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(link, [](FEXCore::Core::InternalThreadState *Thread, const char *oldpath, const char *newpath) -> uint64_t {
       uint64_t Result = ::link(oldpath, newpath);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(unlink, [](FEXCore::Core::InternalThreadState *Thread, const char *pathname) -> uint64_t {
       uint64_t Result = ::unlink(pathname);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL(symlink, [](FEXCore::Core::InternalThreadState *Thread, const char *target, const char *linkpath) -> uint64_t {
       uint64_t Result = ::symlink(target, linkpath);
+      if (Result != -1) {
+        FEX::HLE::_SyscallHandler->FM.InvalidateRootFSCache();
+      }
       SYSCALL_ERRNO();
     });
 
@@ -5,6 +5,7 @@
 #include <cstring>
 #include <linux/kcmp.h>
 #include <linux/seccomp.h>
+#include <sched.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -55,22 +56,23 @@ namespace FEX::HLE {
     });
 
     REGISTER_SYSCALL_IMPL(getcpu, [](FEXCore::Core::InternalThreadState *Thread, unsigned *cpu, unsigned *node, struct getcpu_cache *tcache) -> uint64_t {
-      uint32_t LocalCPU{};
-      uint32_t LocalNode{};
       // tcache is ignored
-      uint64_t Result = ::syscall(SYS_getcpu, cpu ? &LocalCPU : nullptr, node ? &LocalNode : nullptr, nullptr);
-      if (Result == 0) {
-        if (cpu) {
-          // Ensure we don't return a number over our number of emulated cores
-          *cpu = LocalCPU % FEX::HLE::_SyscallHandler->ThreadsConfig();
-        }
+      // libc reads the CPU through the host's vDSO, the guest's vDSO getcpu ends up here
+      int LocalCPU = sched_getcpu();
+      if (LocalCPU == -1) {
+        return -errno;
+      }
 
-        if (node) {
-          // Just claim we are part of node zero
-          *node = 0;
-        }
+      if (cpu) {
+        // Ensure we don't return a number over our number of emulated cores
+        *cpu = LocalCPU % FEX::HLE::_SyscallHandler->ThreadsConfig();
       }
-      SYSCALL_ERRNO();
+
+      if (node) {
+        // Just claim we are part of node zero
+        *node = 0;
+      }
+      return 0;
     });
 
     //compare  two  processes  to determine if they share a kernel resource
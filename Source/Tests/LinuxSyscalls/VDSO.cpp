@@ -0,0 +1,283 @@
+#include "Tests/LinuxSyscalls/VDSO.h"
+#include "Tests/LinuxSyscalls/x32/Syscalls.h"
+#include "Tests/LinuxSyscalls/x64/Syscalls.h"
+
+#include <FEXCore/Utils/LogManager.h>
+
+#include <array>
+#include <cstring>
+#include <elf.h>
+#include <string_view>
+#include <sys/mman.h>
+#include <vector>
+
+namespace {
+  constexpr size_t VDSO_SIZE = 0x1000;
+
+  // Just below the 32bit stack mapping, out of the way of the ELF and the allocator's bottom up search
+  constexpr uint64_t VDSO_32BIT_ADDR = 0xbfff'f000ULL;
+
+  struct VDSOFunction {
+    std::string_view Name;
+    uint32_t SyscallNumber;
+    bool Weak;
+  };
+
+  // x86-64 exports the bare names as weak aliases as well
+  constexpr std::array<VDSOFunction, 10> Functions64 = {{
+    {"__vdso_clock_gettime", FEX::HLE::x64::SYSCALL_x64_clock_gettime, false},
+    {"__vdso_gettimeofday",  FEX::HLE::x64::SYSCALL_x64_gettimeofday,  false},
+    {"__vdso_time",          FEX::HLE::x64::SYSCALL_x64_time,          false},
+    {"__vdso_getcpu",        FEX::HLE::x64::SYSCALL_x64_getcpu,        false},
+    {"__vdso_clock_getres",  FEX::HLE::x64::SYSCALL_x64_clock_getres,  false},
+    {"clock_gettime",        FEX::HLE::x64::SYSCALL_x64_clock_gettime, true},
+    {"gettimeofday",         FEX::HLE::x64::SYSCALL_x64_gettimeofday,  true},
+    {"time",                 FEX::HLE::x64::SYSCALL_x64_time,          true},
+    {"getcpu",               FEX::HLE::x64::SYSCALL_x64_getcpu,        true},
+    {"clock_getres",         FEX::HLE::x64::SYSCALL_x64_clock_getres,  true},
+  }};
+
+  constexpr std::array<VDSOFunction, 6> Functions32 = {{
+    {"__vdso_clock_gettime",   FEX::HLE::x32::SYSCALL_x86_clock_gettime,   false},
+    {"__vdso_gettimeofday",    FEX::HLE::x32::SYSCALL_x86_gettimeofday,    false},
+    {"__vdso_time",            FEX::HLE::x32::SYSCALL_x86_time,            false},
+    {"__vdso_getcpu",          FEX::HLE::x32::SYSCALL_x86_getcpu,          false},
+    {"__vdso_clock_getres",    FEX::HLE::x32::SYSCALL_x86_clock_getres,    false},
+    {"__vdso_clock_gettime64", FEX::HLE::x32::SYSCALL_x86_clock_gettime64, false},
+  }};
+
+  struct ELF64Traits {
+    using Ehdr = Elf64_Ehdr;
+    using Phdr = Elf64_Phdr;
+    using Sym = Elf64_Sym;
+    using Dyn = Elf64_Dyn;
+    static constexpr uint8_t Class = ELFCLASS64;
+    static constexpr uint16_t Machine = EM_X86_64;
+    static constexpr size_t StubSize = 16;
+
+    static uint8_t SymbolInfo(bool Weak) {
+      return ELF64_ST_INFO(Weak ? STB_WEAK : STB_GLOBAL, STT_FUNC);
+    }
+
+    // mov eax, <NR>
+    // syscall
+    // ret
+    static void EmitStub(uint8_t *Code, uint32_t SyscallNumber) {
+      Code[0] = 0xB8;
+      memcpy(&Code[1], &SyscallNumber, sizeof(SyscallNumber));
+      Code[5] = 0x0F;
+      Code[6] = 0x05;
+      Code[7] = 0xC3;
+    }
+  };
+
+  struct ELF32Traits {
+    using Ehdr = Elf32_Ehdr;
+    using Phdr = Elf32_Phdr;
+    using Sym = Elf32_Sym;
+    using Dyn = Elf32_Dyn;
+    static constexpr uint8_t Class = ELFCLASS32;
+    static constexpr uint16_t Machine = EM_386;
+    static constexpr size_t StubSize = 32;
+
+    static uint8_t SymbolInfo(bool Weak) {
+      return ELF32_ST_INFO(Weak ? STB_WEAK : STB_GLOBAL, STT_FUNC);
+    }
+
+    // Arguments come in on the stack, the syscall wants them in ebx, ecx, edx
+    // push ebx
+    // mov ebx, [esp + 8]
+    // mov ecx, [esp + 12]
+    // mov edx, [esp + 16]
+    // mov eax, <NR>
+    // int 0x80
+    // pop ebx
+    // ret
+    static void EmitStub(uint8_t *Code, uint32_t SyscallNumber) {
+      constexpr uint8_t Prologue[] = {
+        0x53,
+        0x8B, 0x5C, 0x24, 0x08,
+        0x8B, 0x4C, 0x24, 0x0C,
+        0x8B, 0x54, 0x24, 0x10,
+      };
+      memcpy(Code, Prologue, sizeof(Prologue));
+      Code += sizeof(Prologue);
+
+      Code[0] = 0xB8;
+      memcpy(&Code[1], &SyscallNumber, sizeof(SyscallNumber));
+      Code[5] = 0xCD;
+      Code[6] = 0x80;
+      Code[7] = 0x5B;
+      Code[8] = 0xC3;
+    }
+  };
+
+  /**
+   * @brief Builds the vDSO as a position independent shared object, everything relative to zero
+   *
+   * Layout is the ELF header, program headers, hash table, symbols, strings, dynamic section then the code.
+   * The dynamic loader only needs the program headers and the dynamic section to find the symbols.
+   */
+  template<typename ELF, size_t N>
+  std::vector<uint8_t> BuildImage(std::array<VDSOFunction, N> const &Functions) {
+    using Ehdr = typename ELF::Ehdr;
+    using Phdr = typename ELF::Phdr;
+    using Sym = typename ELF::Sym;
+    using Dyn = typename ELF::Dyn;
+
+    constexpr std::string_view SOName = "linux-vdso.so.1";
+    constexpr size_t NumSymbols = N + 1;
+    constexpr size_t NumDyn = 7;
+
+    // Strings, index 0 is the empty string
+    std::vector<char> Strings(1);
+    auto AddString = [&Strings](std::string_view Str) -> uint32_t {
+      uint32_t Offset = Strings.size();
+      Strings.insert(Strings.end(), Str.begin(), Str.end());
+      Strings.emplace_back(0);
+      return Offset;
+    };
+
+    std::array<uint32_t, N> NameOffsets;
+    for (size_t i = 0; i < N; ++i) {
+      NameOffsets[i] = AddString(Functions[i].Name);
+    }
+    uint32_t SONameOffset = AddString(SOName);
+
+    auto Align = [](size_t Offset, size_t Alignment) {
+      return (Offset + Alignment - 1) & ~(Alignment - 1);
+    };
+
+    // As many buckets as symbols keeps the chains short
+    const size_t HashOffset = sizeof(Ehdr) + 2 * sizeof(Phdr);
+    const size_t HashSize = (2 + NumSymbols + NumSymbols) * sizeof(uint32_t);
+    const size_t SymOffset = Align(HashOffset + HashSize, alignof(Sym));
+    const size_t StrOffset = SymOffset + NumSymbols * sizeof(Sym);
+    const size_t DynOffset = Align(StrOffset + Strings.size(), alignof(Dyn));
+    const size_t TextOffset = Align(DynOffset + NumDyn * sizeof(Dyn), ELF::StubSize);
+
+    LogMan::Throw::A(TextOffset + N * ELF::StubSize <= VDSO_SIZE, "vDSO image doesn't fit in a page");
+
+    std::vector<uint8_t> Image(VDSO_SIZE);
+    uint8_t *Data = Image.data();
+
+    auto Header = reinterpret_cast<Ehdr*>(Data);
+    memcpy(Header->e_ident, ELFMAG, SELFMAG);
+    Header->e_ident[EI_CLASS] = ELF::Class;
+    Header->e_ident[EI_DATA] = ELFDATA2LSB;
+    Header->e_ident[EI_VERSION] = EV_CURRENT;
+    Header->e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    Header->e_type = ET_DYN;
+    Header->e_machine = ELF::Machine;
+    Header->e_version = EV_CURRENT;
+    Header->e_phoff = sizeof(Ehdr);
+    Header->e_ehsize = sizeof(Ehdr);
+    Header->e_phentsize = sizeof(Phdr);
+    Header->e_phnum = 2;
+    Header->e_shentsize = 0;
+    Header->e_shnum = 0;
+    Header->e_shstrndx = SHN_UNDEF;
+
+    auto ProgramHeaders = reinterpret_cast<Phdr*>(Data + sizeof(Ehdr));
+    ProgramHeaders[0].p_type = PT_LOAD;
+    ProgramHeaders[0].p_flags = PF_R | PF_X;
+    ProgramHeaders[0].p_offset = 0;
+    ProgramHeaders[0].p_vaddr = 0;
+    ProgramHeaders[0].p_paddr = 0;
+    ProgramHeaders[0].p_filesz = VDSO_SIZE;
+    ProgramHeaders[0].p_memsz = VDSO_SIZE;
+    ProgramHeaders[0].p_align = VDSO_SIZE;
+
+    ProgramHeaders[1].p_type = PT_DYNAMIC;
+    ProgramHeaders[1].p_flags = PF_R;
+    ProgramHeaders[1].p_offset = DynOffset;
+    ProgramHeaders[1].p_vaddr = DynOffset;
+    ProgramHeaders[1].p_paddr = DynOffset;
+    ProgramHeaders[1].p_filesz = NumDyn * sizeof(Dyn);
+    ProgramHeaders[1].p_memsz = NumDyn * sizeof(Dyn);
+    ProgramHeaders[1].p_align = alignof(Dyn);
+
+    // SysV hash table: nbucket, nchain, buckets, chains
+    auto Hash = reinterpret_cast<uint32_t*>(Data + HashOffset);
+    auto Buckets = &Hash[2];
+    auto Chains = &Hash[2 + NumSymbols];
+    Hash[0] = NumSymbols;
+    Hash[1] = NumSymbols;
+    for (size_t i = 0; i < N; ++i) {
+      uint32_t h = 0;
+      for (char c : Functions[i].Name) {
+        h = (h << 4) + static_cast<uint8_t>(c);
+        uint32_t g = h & 0xF000'0000U;
+        h ^= g >> 24;
+        h &= ~g;
+      }
+
+      // Symbol i + 1 goes on the front of its bucket's chain
+      uint32_t &Bucket = Buckets[h % NumSymbols];
+      Chains[i + 1] = Bucket;
+      Bucket = i + 1;
+    }
+
+    auto Symbols = reinterpret_cast<Sym*>(Data + SymOffset);
+    for (size_t i = 0; i < N; ++i) {
+      auto &Symbol = Symbols[i + 1];
+      Symbol.st_name = NameOffsets[i];
+      Symbol.st_info = ELF::SymbolInfo(Functions[i].Weak);
+      Symbol.st_other = STV_DEFAULT;
+      // Loaders skip SHN_UNDEF symbols, any real section index does
+      Symbol.st_shndx = 1;
+      Symbol.st_value = TextOffset + i * ELF::StubSize;
+      Symbol.st_size = ELF::StubSize;
+
+      ELF::EmitStub(Data + Symbol.st_value, Functions[i].SyscallNumber);
+    }
+
+    memcpy(Data + StrOffset, Strings.data(), Strings.size());
+
+    auto Dynamic = reinterpret_cast<Dyn*>(Data + DynOffset);
+    const std::array<std::pair<decltype(Dyn::d_tag), size_t>, NumDyn> DynamicEntries = {{
+      {DT_HASH, HashOffset},
+      {DT_STRTAB, StrOffset},
+      {DT_SYMTAB, SymOffset},
+      {DT_STRSZ, Strings.size()},
+      {DT_SYMENT, sizeof(Sym)},
+      {DT_SONAME, SONameOffset},
+      {DT_NULL, 0},
+    }};
+
+    for (size_t i = 0; i < NumDyn; ++i) {
+      Dynamic[i].d_tag = DynamicEntries[i].first;
+      Dynamic[i].d_un.d_val = DynamicEntries[i].second;
+    }
+
+    return Image;
+  }
+}
+
+namespace FEX::HLE::VDSO {
+  uint64_t LoadVDSO(bool Is64Bit) {
+    std::vector<uint8_t> Image = Is64Bit ?
+      BuildImage<ELF64Traits>(Functions64) :
+      BuildImage<ELF32Traits>(Functions32);
+
+    void *Ptr{};
+    if (Is64Bit) {
+      Ptr = mmap(nullptr, VDSO_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    else {
+      Ptr = mmap(reinterpret_cast<void*>(VDSO_32BIT_ADDR), VDSO_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+      if (Ptr == MAP_FAILED) {
+        Ptr = mmap(nullptr, VDSO_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+      }
+    }
+
+    if (Ptr == MAP_FAILED) {
+      LogMan::Msg::E("Couldn't map the vDSO, guest will fall back to syscalls");
+      return 0;
+    }
+
+    memcpy(Ptr, Image.data(), Image.size());
+    mprotect(Ptr, VDSO_SIZE, PROT_READ | PROT_EXEC);
+    return reinterpret_cast<uint64_t>(Ptr);
+  }
+}
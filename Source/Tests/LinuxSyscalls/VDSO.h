@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+namespace FEX::HLE::VDSO {
+  /**
+   * @brief Maps a vDSO image for the guest's architecture and returns where it lives, for AT_SYSINFO_EHDR
+   *
+   * Each entry point is just the guest's syscall sequence with a constant syscall number.
+   * The syscall optimization pass turns those in to direct calls of the frontend's handlers, which read the time
+   * through the host's own vDSO. So a guest clock_gettime skips the syscall dispatcher and doesn't make a host syscall.
+   * None of these are on the x86-64 InlineSyscall list, which would issue a real host syscall instead.
+   *
+   * That relies on syscallopt, which isn't part of the O0 pipeline. At O0 the stubs take the full syscall dispatch,
+   * still correct but no cheaper than the guest making the syscall itself.
+   *
+   * @return Guest address of the image, zero if it couldn't be mapped
+   */
+  uint64_t LoadVDSO(bool Is64Bit);
+}
@@ -1,12 +1,15 @@
 #include "Common/MathUtils.h"
 
 #include "Tests/LinuxSyscalls/Syscalls.h"
+#include "Tests/LinuxSyscalls/x32/Marshalling.h"
 #include "Tests/LinuxSyscalls/x32/Syscalls.h"
 #include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/Utils/LogManager.h>
 
+#include <cstring>
 #include <dirent.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <signal.h>
 #include <stdint.h>
 #include <sys/file.h>
@@ -98,21 +101,26 @@ namespace FEX::HLE::x32 {
     });
 
     REGISTER_SYSCALL_IMPL_X32(readv, [](FEXCore::Core::InternalThreadState *Thread, int fd, const struct iovec32 *iov, int iovcnt) -> uint64_t {
-      std::vector<iovec> Host_iovec(iovcnt);
-      for (int i = 0; i < iovcnt; ++i) {
-        Host_iovec[i] = iov[i];
+      if (iovcnt < 0 || iovcnt > IOV_MAX) {
+        return -EINVAL;
       }
 
-      uint64_t Result = ::readv(fd, &Host_iovec.at(0), iovcnt);
+      ScratchArena::Scope Scratch;
+      auto Host_iovec = ToHost<iovec>(Scratch, iov, iovcnt);
+
+      uint64_t Result = ::readv(fd, Host_iovec, iovcnt);
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(writev, [](FEXCore::Core::InternalThreadState *Thread, int fd, const struct iovec32 *iov, int iovcnt) -> uint64_t {
-      std::vector<iovec> Host_iovec(iovcnt);
-      for (int i = 0; i < iovcnt; ++i) {
-        Host_iovec[i] = iov[i];
+      if (iovcnt < 0 || iovcnt > IOV_MAX) {
+        return -EINVAL;
       }
-      uint64_t Result = ::writev(fd, &Host_iovec.at(0), iovcnt);
+
+      ScratchArena::Scope Scratch;
+      auto Host_iovec = ToHost<iovec>(Scratch, iov, iovcnt);
+
+      uint64_t Result = ::writev(fd, Host_iovec, iovcnt);
       SYSCALL_ERRNO();
     });
 
@@ -275,74 +283,76 @@ namespace FEX::HLE::x32 {
     });
 
     REGISTER_SYSCALL_IMPL_X32(preadv, [](FEXCore::Core::InternalThreadState *Thread, int fd, const struct iovec32 *iov, int iovcnt, off_t offset) -> uint64_t {
-      std::vector<iovec> Host_iovec(iovcnt);
-      for (int i = 0; i < iovcnt; ++i) {
-        Host_iovec[i] = iov[i];
+      if (iovcnt < 0 || iovcnt > IOV_MAX) {
+        return -EINVAL;
       }
 
-      uint64_t Result = ::preadv(fd, &Host_iovec.at(0), iovcnt, offset);
+      ScratchArena::Scope Scratch;
+      auto Host_iovec = ToHost<iovec>(Scratch, iov, iovcnt);
+
+      uint64_t Result = ::preadv(fd, Host_iovec, iovcnt, offset);
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(pwritev, [](FEXCore::Core::InternalThreadState *Thread, int fd, const struct iovec32 *iov, int iovcnt, off_t offset) -> uint64_t {
-      std::vector<iovec> Host_iovec(iovcnt);
-      for (int i = 0; i < iovcnt; ++i) {
-        Host_iovec[i] = iov[i];
+      if (iovcnt < 0 || iovcnt > IOV_MAX) {
+        return -EINVAL;
       }
 
-      uint64_t Result = ::pwritev(fd, &Host_iovec.at(0), iovcnt, offset);
+      ScratchArena::Scope Scratch;
+      auto Host_iovec = ToHost<iovec>(Scratch, iov, iovcnt);
+
+      uint64_t Result = ::pwritev(fd, Host_iovec, iovcnt, offset);
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(process_vm_readv, [](FEXCore::Core::InternalThreadState *Thread, pid_t pid, const struct iovec32 *local_iov, unsigned long liovcnt, const struct iovec32 *remote_iov, unsigned long riovcnt, unsigned long flags) -> uint64_t {
-      std::vector<iovec> Host_local_iovec(liovcnt);
-      std::vector<iovec> Host_remote_iovec(riovcnt);
-
-      for (int i = 0; i < liovcnt; ++i) {
-        Host_local_iovec[i] = local_iov[i];
+      if (liovcnt > IOV_MAX || riovcnt > IOV_MAX) {
+        return -EINVAL;
       }
 
-      for (int i = 0; i < riovcnt; ++i) {
-        Host_remote_iovec[i] = remote_iov[i];
-      }
+      ScratchArena::Scope Scratch;
+      auto Host_local_iovec = ToHost<iovec>(Scratch, local_iov, liovcnt);
+      auto Host_remote_iovec = ToHost<iovec>(Scratch, remote_iov, riovcnt);
 
-      uint64_t Result = ::process_vm_readv(pid, &Host_local_iovec.at(0), liovcnt, &Host_remote_iovec.at(0), riovcnt, flags);
+      uint64_t Result = ::process_vm_readv(pid, Host_local_iovec, liovcnt, Host_remote_iovec, riovcnt, flags);
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(process_vm_writev, [](FEXCore::Core::InternalThreadState *Thread, pid_t pid, const struct iovec32 *local_iov, unsigned long liovcnt, const struct iovec32 *remote_iov, unsigned long riovcnt, unsigned long flags) -> uint64_t {
-      std::vector<iovec> Host_local_iovec(liovcnt);
-      std::vector<iovec> Host_remote_iovec(riovcnt);
-
-      for (int i = 0; i < liovcnt; ++i) {
-        Host_local_iovec[i] = local_iov[i];
+      if (liovcnt > IOV_MAX || riovcnt > IOV_MAX) {
+        return -EINVAL;
       }
 
-      for (int i = 0; i < riovcnt; ++i) {
-        Host_remote_iovec[i] = remote_iov[i];
-      }
+      ScratchArena::Scope Scratch;
+      auto Host_local_iovec = ToHost<iovec>(Scratch, local_iov, liovcnt);
+      auto Host_remote_iovec = ToHost<iovec>(Scratch, remote_iov, riovcnt);
 
-      uint64_t Result = ::process_vm_writev(pid, &Host_local_iovec.at(0), liovcnt, &Host_remote_iovec.at(0), riovcnt, flags);
+      uint64_t Result = ::process_vm_writev(pid, Host_local_iovec, liovcnt, Host_remote_iovec, riovcnt, flags);
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(preadv2, [](FEXCore::Core::InternalThreadState *Thread, int fd, const struct iovec32 *iov, int iovcnt, off_t offset, int flags) -> uint64_t {
-      std::vector<iovec> Host_iovec(iovcnt);
-      for (int i = 0; i < iovcnt; ++i) {
-        Host_iovec[i] = iov[i];
+      if (iovcnt < 0 || iovcnt > IOV_MAX) {
+        return -EINVAL;
       }
 
-      uint64_t Result = ::preadv2(fd, &Host_iovec.at(0), iovcnt, offset, flags);
+      ScratchArena::Scope Scratch;
+      auto Host_iovec = ToHost<iovec>(Scratch, iov, iovcnt);
+
+      uint64_t Result = ::preadv2(fd, Host_iovec, iovcnt, offset, flags);
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(pwritev2, [](FEXCore::Core::InternalThreadState *Thread, int fd, const struct iovec32 *iov, int iovcnt, off_t offset, int flags) -> uint64_t {
-      std::vector<iovec> Host_iovec(iovcnt);
-      for (int i = 0; i < iovcnt; ++i) {
-        Host_iovec[i] = iov[i];
+      if (iovcnt < 0 || iovcnt > IOV_MAX) {
+        return -EINVAL;
       }
 
-      uint64_t Result = ::pwritev2(fd, &Host_iovec.at(0), iovcnt, offset, flags);
+      ScratchArena::Scope Scratch;
+      auto Host_iovec = ToHost<iovec>(Scratch, iov, iovcnt);
+
+      uint64_t Result = ::pwritev2(fd, Host_iovec, iovcnt, offset, flags);
       SYSCALL_ERRNO();
     });
 
@@ -365,8 +375,8 @@ namespace FEX::HLE::x32 {
 
     REGISTER_SYSCALL_IMPL_X32(getdents, [](FEXCore::Core::InternalThreadState *Thread, int fd, void *dirp, uint32_t count) -> uint64_t {
 #ifdef SYS_getdents
-      std::vector<uint8_t> TmpVector(count);
-      void *TmpPtr = reinterpret_cast<void*>(&TmpVector.at(0));
+      ScratchArena::Scope Scratch;
+      void *TmpPtr = Scratch.Allocate<uint8_t>(count);
 
       // Copy the incoming structures to our temporary array
       for (uint64_t Offset = 0, TmpOffset = 0;
@@ -526,5 +536,19 @@ namespace FEX::HLE::x32 {
       uint64_t Result = ::posix_fadvise64(fd, Offset, Len, advice);
       SYSCALL_ERRNO();
     });
+
+    // The kernel reads the submission queue straight out of the rings as a 64bit task, with pointers and iovecs
+    // in the host's layout. Claiming there is no io_uring gets liburing and everything else to fall back to regular syscalls
+    REGISTER_SYSCALL_IMPL_X32(io_uring_setup, [](FEXCore::Core::InternalThreadState *Thread, uint32_t entries, void *p) -> uint64_t {
+      return -ENOSYS;
+    });
+
+    REGISTER_SYSCALL_IMPL_X32(io_uring_enter, [](FEXCore::Core::InternalThreadState *Thread, unsigned int fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags, void *argp, size_t argsz) -> uint64_t {
+      return -ENOSYS;
+    });
+
+    REGISTER_SYSCALL_IMPL_X32(io_uring_register, [](FEXCore::Core::InternalThreadState *Thread, unsigned int fd, unsigned int opcode, void *arg, uint32_t nr_args) -> uint64_t {
+      return -ENOSYS;
+    });
   }
 }
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace FEX::HLE::x32 {
+
+/**
+ * @brief Per-thread bump allocator for the host copies of guest structures
+ *
+ * Anything taken from a Scope is given back when the Scope ends, so a syscall wrapper never frees anything itself.
+ * Scopes nest like a stack, which keeps a guest signal handler that syscalls in the middle of another syscall safe.
+ * Requests that don't fit in what is left of the arena spill to the heap for the lifetime of the Scope.
+ */
+class ScratchArena final {
+public:
+  class Scope final {
+  public:
+    Scope()
+      : Arena {Get()}
+      , StartOffset {Arena.Offset} {
+    }
+
+    ~Scope() {
+      Arena.Offset = StartOffset;
+    }
+
+    Scope(Scope const&) = delete;
+    Scope &operator=(Scope const&) = delete;
+
+    template<typename T>
+    T *Allocate(size_t Count) {
+      static_assert(std::is_trivially_destructible<T>::value, "Scratch memory is never destructed");
+      static_assert(alignof(T) <= ARENA_ALIGNMENT, "Arena can't align this type");
+
+      // Everything gets the full alignment, so raw byte buffers can hold any host structure
+      size_t Size = Count * sizeof(T);
+      size_t Start = (Arena.Offset + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+      if (Start + Size <= ARENA_SIZE) {
+        Arena.Offset = Start + Size;
+        return reinterpret_cast<T*>(&Arena.Data[Start]);
+      }
+
+      auto &Spill = Spills.emplace_back(new uint8_t[Size]);
+      return reinterpret_cast<T*>(Spill.get());
+    }
+
+  private:
+    ScratchArena &Arena;
+    size_t StartOffset;
+    std::vector<std::unique_ptr<uint8_t[]>> Spills;
+  };
+
+private:
+  static constexpr size_t ARENA_SIZE = 64 * 1024;
+  // Both the arena and spills come from plain new, so this is all the alignment there is
+  static constexpr size_t ARENA_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  // Allocated on the thread's first use so threads that never marshal anything don't pay for it
+  static ScratchArena &Get() {
+    thread_local ScratchArena Arena;
+    if (!Arena.Data) {
+      Arena.Data = std::make_unique<uint8_t[]>(ARENA_SIZE);
+    }
+    return Arena;
+  }
+
+  std::unique_ptr<uint8_t[]> Data;
+  size_t Offset{};
+};
+
+/**
+ * @brief Widens an array of guest structures in to scratch memory through the guest type's conversion operator
+ */
+template<typename HostT, typename GuestT>
+HostT *ToHost(ScratchArena::Scope &Scratch, GuestT const *Guest, size_t Count) {
+  HostT *Host = Scratch.Allocate<HostT>(Count);
+  for (size_t i = 0; i < Count; ++i) {
+    Host[i] = Guest[i];
+  }
+  return Host;
+}
+
+/**
+ * @brief Narrows an array of host structures back in to guest memory
+ */
+template<typename GuestT, typename HostT>
+void FromHost(GuestT *Guest, HostT const *Host, size_t Count) {
+  for (size_t i = 0; i < Count; ++i) {
+    Guest[i] = Host[i];
+  }
+}
+
+}
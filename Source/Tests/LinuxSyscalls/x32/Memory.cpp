@@ -3,12 +3,28 @@
 
 #include "Common/MathUtils.h"
 
-#include <bitset>
+#include <cstdio>
+#include <map>
+#include <set>
 #include <stddef.h>
 #include <stdint.h>
 #include <sys/mman.h>
 
+#ifndef MREMAP_DONTUNMAP
+#define MREMAP_DONTUNMAP 4
+#endif
+
 namespace FEX::HLE::x32 {
+/**
+ * @brief Tracks which parts of the 32bit guest address space are free
+ *
+ * Free extents live in two trees, one ordered by address and one by size.
+ * The address tree is for merging on unmap and for splitting around fixed mappings and hints.
+ * The size tree gives a best fit lookup, lowest address first, so nothing here scans the address space.
+ *
+ * Mappings that didn't go through us (the ELF, the stack, FEX's own allocations) are only found once the host
+ * refuses a range, at which point everything the host has mapped below 4GB is taken out of the free trees.
+ */
 class MemAllocator {
 private:
   static constexpr uint64_t PAGE_SHIFT = 12;
@@ -20,74 +36,164 @@ private:
 public:
   MemAllocator() {
     // First 16 pages are taken by the Linux kernel
-    for (size_t i = 0; i < 16; ++i) {
-      MappedPages.set(i);
-    }
     // Take the top page as well
-    MappedPages.set(TOP_KEY);
+    InsertFree(BASE_KEY, TOP_KEY - BASE_KEY);
   }
   void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset);
   int munmap(void *addr, size_t length);
   void *mremap(void *old_address, size_t old_size, size_t new_size, int flags, void *new_address);
 
 private:
-  // Set that contains 4k mapped pages
-  // This is the full 32bit memory range
-  std::bitset<0x10'0000> MappedPages;
-  uint64_t LastScanLocation = BASE_KEY;
+  // Start page to page count
+  std::map<uint64_t, uint64_t> FreeByAddress;
+  // Page count and start page
+  std::set<std::pair<uint64_t, uint64_t>> FreeBySize;
   std::mutex AllocMutex{};
-  uint64_t FindPageRange(uint64_t Start, size_t Pages);
-  uint64_t FindPageRange_TopDown(uint64_t Start, size_t Pages);
+
+  void InsertFree(uint64_t Start, uint64_t Pages);
+  std::map<uint64_t, uint64_t>::iterator EraseFree(std::map<uint64_t, uint64_t>::iterator Extent);
+
+  void MarkFree(uint64_t Start, uint64_t Pages);
+  bool MarkUsed(uint64_t Start, uint64_t Pages);
+  bool IsFree(uint64_t Start, uint64_t Pages) const;
+  uint64_t FindPageRange(uint64_t Pages) const;
+  bool ReserveHostMappings();
+  uint64_t ReserveRange(uint64_t Pages);
 };
 
-uint64_t MemAllocator::FindPageRange(uint64_t Start, size_t Pages) {
-  // Linear range scan
-  while (Start != TOP_KEY) {
-    bool Free = true;
-    if ((Start + Pages) > TOP_KEY) {
-      return 0;
+void MemAllocator::InsertFree(uint64_t Start, uint64_t Pages) {
+  FreeByAddress.emplace(Start, Pages);
+  FreeBySize.emplace(Pages, Start);
+}
+
+std::map<uint64_t, uint64_t>::iterator MemAllocator::EraseFree(std::map<uint64_t, uint64_t>::iterator Extent) {
+  FreeBySize.erase({Extent->second, Extent->first});
+  return FreeByAddress.erase(Extent);
+}
+
+void MemAllocator::MarkFree(uint64_t Start, uint64_t Pages) {
+  uint64_t End = std::min(Start + Pages, TOP_KEY);
+  Start = std::max(Start, BASE_KEY);
+  if (Start >= End) {
+    return;
+  }
+
+  // Merge with every extent that overlaps or touches the range
+  auto Extent = FreeByAddress.upper_bound(Start);
+  if (Extent != FreeByAddress.begin()) {
+    auto Prev = std::prev(Extent);
+    if (Prev->first + Prev->second >= Start) {
+      Extent = Prev;
     }
-    uint64_t Offset = 0;
-    for (; Offset < Pages; ++Offset) {
-      if (MappedPages.test(Start + Offset)) {
-        Free = false;
-        break;
-      }
+  }
+
+  while (Extent != FreeByAddress.end() && Extent->first <= End) {
+    Start = std::min(Start, Extent->first);
+    End = std::max(End, Extent->first + Extent->second);
+    Extent = EraseFree(Extent);
+  }
+
+  InsertFree(Start, End - Start);
+}
+
+bool MemAllocator::MarkUsed(uint64_t Start, uint64_t Pages) {
+  uint64_t End = Start + Pages;
+  bool Changed = false;
+
+  auto Extent = FreeByAddress.upper_bound(Start);
+  if (Extent != FreeByAddress.begin()) {
+    auto Prev = std::prev(Extent);
+    if (Prev->first + Prev->second > Start) {
+      Extent = Prev;
     }
+  }
 
-    if (Free) {
-      return Start;
+  // Split each overlapping extent around the range
+  while (Extent != FreeByAddress.end() && Extent->first < End) {
+    uint64_t ExtentStart = Extent->first;
+    uint64_t ExtentEnd = ExtentStart + Extent->second;
+    Extent = EraseFree(Extent);
+    Changed = true;
+
+    if (ExtentStart < Start) {
+      InsertFree(ExtentStart, Start - ExtentStart);
+    }
+    if (ExtentEnd > End) {
+      InsertFree(End, ExtentEnd - End);
     }
-    Start += Offset + 1;
   }
 
-  return 0;
+  return Changed;
+}
+
+bool MemAllocator::IsFree(uint64_t Start, uint64_t Pages) const {
+  auto Extent = FreeByAddress.upper_bound(Start);
+  if (Extent == FreeByAddress.begin()) {
+    return false;
+  }
+  --Extent;
+  return Extent->first + Extent->second >= Start + Pages;
 }
 
-uint64_t MemAllocator::FindPageRange_TopDown(uint64_t Start, size_t Pages) {
-  // Linear range scan
-  Start -= Pages;
-  while (Start != BASE_KEY) {
-    bool Free = true;
-    if (Start < BASE_KEY) {
+uint64_t MemAllocator::FindPageRange(uint64_t Pages) const {
+  // Smallest extent that fits, lowest address on ties
+  auto Extent = FreeBySize.lower_bound({Pages, 0});
+  if (Extent == FreeBySize.end()) {
+    return 0;
+  }
+  return Extent->second;
+}
+
+bool MemAllocator::ReserveHostMappings() {
+  FILE *Maps = fopen("/proc/self/maps", "rb");
+  if (!Maps) {
+    return false;
+  }
+
+  bool Changed = false;
+  char *Line{};
+  size_t LineSize{};
+  while (getline(&Line, &LineSize, Maps) != -1) {
+    uint64_t Begin, End;
+    if (sscanf(Line, "%lx-%lx", &Begin, &End) != 2 ||
+        Begin >= (TOP_KEY << PAGE_SHIFT)) {
+      continue;
+    }
+
+    uint64_t StartPage = Begin >> PAGE_SHIFT;
+    uint64_t EndPage = std::min(AlignUp(End, PAGE_SIZE) >> PAGE_SHIFT, TOP_KEY);
+    Changed |= MarkUsed(StartPage, EndPage - StartPage);
+  }
+
+  free(Line);
+  fclose(Maps);
+  return Changed;
+}
+
+uint64_t MemAllocator::ReserveRange(uint64_t Pages) {
+  // Claims a range with the host as well so a later MAP_FIXED or MREMAP_FIXED can't clobber something we didn't know about
+  while (true) {
+    uint64_t LowerPage = FindPageRange(Pages);
+    if (LowerPage == 0) {
       return 0;
     }
 
-    uint64_t Offset = 0;
-    for (; Offset < Pages; ++Offset) {
-      if (MappedPages.test(Start + Offset)) {
-        Free = false;
-        break;
-      }
+    void *MappedPtr = ::mmap(
+      reinterpret_cast<void*>(LowerPage << PAGE_SHIFT),
+      Pages << PAGE_SHIFT,
+      PROT_NONE,
+      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE,
+      -1, 0);
+
+    if (MappedPtr != MAP_FAILED) {
+      MarkUsed(LowerPage, Pages);
+      return LowerPage;
     }
 
-    if (Free) {
-      return Start;
+    if (errno != EEXIST || !ReserveHostMappings()) {
+      return 0;
     }
-    Start -= (Pages - Offset) + 1;
   }
-
-  return 0;
 }
 
 void *MemAllocator::mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset) {
@@ -97,8 +203,6 @@ void *MemAllocator::mmap(void *addr, size_t length, int prot, int flags, int fd,
   uintptr_t Addr = reinterpret_cast<uintptr_t>(addr);
   uintptr_t PageAddr = AlignUp(Addr, PAGE_SIZE) >> PAGE_SHIFT;
 
-  uintptr_t PageEnd = PageAddr + PagesLength;
-
   bool Fixed = ((flags & MAP_FIXED) ||
       (flags & MAP_FIXED_NOREPLACE));
 
@@ -122,70 +226,7 @@ void *MemAllocator::mmap(void *addr, size_t length, int prot, int flags, int fd,
     return (void*)-EINVAL;
   }
 
-  if (!Fixed) {
-    // If we aren't mapping fixed the ignore the address input
-    Addr = 0;
-    PageAddr = 0;
-    PageEnd = PagesLength;
-  }
-
-  // Find a region that fits our address
-  if (Addr == 0) {
-    bool Wrapped = false;
-    uint64_t BottomPage = LastScanLocation;
-restart:
-    {
-      // Linear range scan
-      uint64_t LowerPage = FindPageRange(BottomPage, PagesLength);
-      if (LowerPage == 0) {
-        // Try again but this time from the start
-        BottomPage = BASE_KEY;
-        LowerPage = FindPageRange(BottomPage, PagesLength);
-      }
-
-      uint64_t UpperPage = LowerPage + PagesLength;
-      if (LowerPage == 0) {
-        return (void*)(uintptr_t)-ENOMEM;
-      }
-      {
-        // Try and map the range
-        void *MappedPtr = ::mmap(
-          reinterpret_cast<void*>(LowerPage<< PAGE_SHIFT),
-          length,
-          prot,
-          flags | MAP_FIXED_NOREPLACE,
-          fd,
-          offset);
-
-        if (MappedPtr == MAP_FAILED) {
-          if (UpperPage == TOP_KEY) {
-            BottomPage = BASE_KEY;
-            Wrapped = true;
-            goto restart;
-          }
-          else if (Wrapped &&
-            LowerPage >= LastScanLocation) {
-            // We linear scanned the entire memory range. Give up
-            return (void*)(uintptr_t)-errno;
-          }
-          else {
-            // Try again
-            BottomPage += PagesLength;
-            goto restart;
-          }
-        }
-        else {
-          LastScanLocation = UpperPage;
-          // Set the range as mapped
-          for (size_t i = 0; i < PagesLength; ++i) {
-            MappedPages.set(LowerPage + i);
-          }
-          return MappedPtr;
-        }
-      }
-    }
-  }
-  else {
+  if (Fixed) {
     void *MappedPtr = ::mmap(
       reinterpret_cast<void*>(PageAddr << PAGE_SHIFT),
       PagesLength << PAGE_SHIFT,
@@ -194,17 +235,47 @@ restart:
       fd,
       offset);
 
+    if (MappedPtr == MAP_FAILED) {
+      return (void*)(uintptr_t)-errno;
+    }
+
+    MarkUsed(PageAddr, PagesLength);
+    return MappedPtr;
+  }
+
+  // Like the kernel, a hint is used as long as the whole range is free
+  bool UseHint = PageAddr >= BASE_KEY && IsFree(PageAddr, PagesLength);
+
+  while (true) {
+    uint64_t LowerPage = UseHint ? PageAddr : FindPageRange(PagesLength);
+    if (LowerPage == 0) {
+      return (void*)(uintptr_t)-ENOMEM;
+    }
+
+    void *MappedPtr = ::mmap(
+      reinterpret_cast<void*>(LowerPage << PAGE_SHIFT),
+      length,
+      prot,
+      flags | MAP_FIXED_NOREPLACE,
+      fd,
+      offset);
+
     if (MappedPtr != MAP_FAILED) {
-      for (size_t i = 0; i < PagesLength; ++i) {
-        MappedPages.set(PageAddr + i);
-      }
+      MarkUsed(LowerPage, PagesLength);
       return MappedPtr;
     }
-    else {
+
+    if (errno != EEXIST) {
       return (void*)(uintptr_t)-errno;
     }
+
+    // Something we weren't tracking is in the way
+    // Once we've picked up everything the host has mapped and it still collides there is nowhere left to go
+    if (!ReserveHostMappings() && !UseHint) {
+      return (void*)(uintptr_t)-ENOMEM;
+    }
+    UseHint = false;
   }
-  return 0;
 }
 
 int MemAllocator::munmap(void *addr, size_t length) {
@@ -214,8 +285,6 @@ int MemAllocator::munmap(void *addr, size_t length) {
   uintptr_t Addr = reinterpret_cast<uintptr_t>(addr);
   uintptr_t PageAddr = Addr >> PAGE_SHIFT;
 
-  uintptr_t PageEnd = PageAddr + PagesLength;
-
   // Both Addr and length must be page aligned
   if (Addr & PAGE_MASK) {
     return -EINVAL;
@@ -235,27 +304,94 @@ int MemAllocator::munmap(void *addr, size_t length) {
     return 0;
   }
 
-  while (PageAddr != PageEnd) {
-    // Always pass to munmap, it may be something allocated we aren't tracking
-    int Result = ::munmap(reinterpret_cast<void*>(PageAddr << PAGE_SHIFT), PAGE_SIZE);
-    if (Result != 0) {
-      return -errno;
-    }
-
-    if (MappedPages.test(PageAddr)) {
-      MappedPages.reset(PageAddr);
-    }
-
-    ++PageAddr;
+  // Always pass to munmap, it may be something allocated we aren't tracking
+  int Result = ::munmap(addr, length);
+  if (Result != 0) {
+    return -errno;
   }
 
+  MarkFree(PageAddr, PagesLength);
   return 0;
 }
 
 void *MemAllocator::mremap(void *old_address, size_t old_size, size_t new_size, int flags, void *new_address) {
   std::scoped_lock<std::mutex> lk{AllocMutex};
-  // XXX: Not currently supported
-  return reinterpret_cast<void*>(-ENOMEM);
+  uintptr_t OldAddr = reinterpret_cast<uintptr_t>(old_address);
+  uint64_t OldPage = OldAddr >> PAGE_SHIFT;
+  uint64_t OldPages = AlignUp(old_size, PAGE_SIZE) >> PAGE_SHIFT;
+  uint64_t NewPages = AlignUp(new_size, PAGE_SIZE) >> PAGE_SHIFT;
+
+  if (OldAddr & PAGE_MASK || NewPages == 0) {
+    return reinterpret_cast<void*>(-EINVAL);
+  }
+
+  // A zero old_size duplicates a shared mapping, the old one stays
+  bool FreesOld = OldPages != 0 && !(flags & MREMAP_DONTUNMAP);
+
+  if (flags & MREMAP_FIXED) {
+    uintptr_t NewAddr = reinterpret_cast<uintptr_t>(new_address);
+    uint64_t NewPage = NewAddr >> PAGE_SHIFT;
+    if (NewAddr & PAGE_MASK ||
+        NewPage < BASE_KEY ||
+        NewPage + NewPages > TOP_KEY) {
+      return reinterpret_cast<void*>(-EINVAL);
+    }
+
+    void *MappedPtr = ::mremap(old_address, old_size, new_size, flags, new_address);
+    if (MappedPtr == MAP_FAILED) {
+      return reinterpret_cast<void*>(-errno);
+    }
+
+    if (FreesOld) {
+      MarkFree(OldPage, OldPages);
+    }
+    MarkUsed(NewPage, NewPages);
+    return MappedPtr;
+  }
+
+  if (NewPages <= OldPages) {
+    // Shrinking always happens in place
+    void *MappedPtr = ::mremap(old_address, old_size, new_size, flags);
+    if (MappedPtr == MAP_FAILED) {
+      return reinterpret_cast<void*>(-errno);
+    }
+
+    MarkFree(OldPage + NewPages, OldPages - NewPages);
+    return MappedPtr;
+  }
+
+  // Grow in place when what follows is free
+  if (OldPages != 0 && IsFree(OldPage + OldPages, NewPages - OldPages)) {
+    void *MappedPtr = ::mremap(old_address, old_size, new_size, flags & ~MREMAP_MAYMOVE);
+    if (MappedPtr != MAP_FAILED) {
+      MarkUsed(OldPage + OldPages, NewPages - OldPages);
+      return MappedPtr;
+    }
+  }
+
+  if (!(flags & MREMAP_MAYMOVE)) {
+    return reinterpret_cast<void*>(-ENOMEM);
+  }
+
+  // The host picking the new location would put it outside of the 32bit space
+  uint64_t NewPage = ReserveRange(NewPages);
+  if (NewPage == 0) {
+    return reinterpret_cast<void*>(-ENOMEM);
+  }
+
+  void *NewPtr = reinterpret_cast<void*>(NewPage << PAGE_SHIFT);
+  void *MappedPtr = ::mremap(old_address, old_size, new_size, flags | MREMAP_FIXED, NewPtr);
+  if (MappedPtr == MAP_FAILED) {
+    int Error = errno;
+    ::munmap(NewPtr, NewPages << PAGE_SHIFT);
+    MarkFree(NewPage, NewPages);
+    return reinterpret_cast<void*>(-Error);
+  }
+
+  if (FreesOld) {
+    MarkFree(OldPage, OldPages);
+  }
+  return MappedPtr;
 }
 
   static std::unique_ptr<MemAllocator> alloc{};
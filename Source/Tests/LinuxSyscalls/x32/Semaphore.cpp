@@ -1,4 +1,5 @@
 #include "Tests/LinuxSyscalls/Syscalls.h"
+#include "Tests/LinuxSyscalls/x32/Marshalling.h"
 #include "Tests/LinuxSyscalls/x32/Syscalls.h"
 
 #include <FEXCore/Utils/LogManager.h>
@@ -621,8 +622,8 @@ namespace FEX::HLE::x32 {
       }
       case OP_MSGSND: {
         // Requires a temporary buffer
-        std::vector<uint8_t> Tmp(second + sizeof(size_t));
-        struct msgbuf *TmpMsg = reinterpret_cast<struct msgbuf *>(&Tmp.at(0));
+        ScratchArena::Scope Scratch;
+        struct msgbuf *TmpMsg = reinterpret_cast<struct msgbuf *>(Scratch.Allocate<uint8_t>(second + sizeof(size_t)));
         msgbuf_32 *src = reinterpret_cast<msgbuf_32*>(ptr);
         TmpMsg->mtype = src->mtype;
         memcpy(TmpMsg->mtext, src->mtext, second);
@@ -631,8 +632,8 @@ namespace FEX::HLE::x32 {
         break;
       }
       case OP_MSGRCV: {
-        std::vector<uint8_t> Tmp(second + sizeof(size_t));
-        struct msgbuf *TmpMsg = reinterpret_cast<struct msgbuf *>(&Tmp.at(0));
+        ScratchArena::Scope Scratch;
+        struct msgbuf *TmpMsg = reinterpret_cast<struct msgbuf *>(Scratch.Allocate<uint8_t>(second + sizeof(size_t)));
 
         Result = ::msgrcv(first, TmpMsg, second, *reinterpret_cast<uint32_t*>(fifth), third);
 
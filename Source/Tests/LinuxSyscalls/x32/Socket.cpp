@@ -1,12 +1,16 @@
 #include "Tests/LinuxSyscalls/Syscalls.h"
+#include "Tests/LinuxSyscalls/x32/Marshalling.h"
 #include "Tests/LinuxSyscalls/x32/Syscalls.h"
 
 #include <FEXCore/Utils/LogManager.h>
 
+#include <algorithm>
 #include <cstring>
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <sys/socket.h>
+#include <unistd.h>
 
 namespace FEX::HLE::x32 {
   enum SockOp {
@@ -32,6 +36,110 @@ namespace FEX::HLE::x32 {
     OP_SENDMMSG = 20,
   };
 
+  // Guest control message headers are 12 bytes with 4 byte alignment, the host's are 16 bytes with 8 byte alignment
+  constexpr size_t GuestCMsgAlign(size_t Len) {
+    return (Len + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+  }
+
+  void ControlToHost(ScratchArena::Scope &Scratch, msghdr32 const *Guest, msghdr *Host) {
+    Host->msg_control = nullptr;
+    Host->msg_controllen = 0;
+    if (!Guest->msg_control) {
+      return;
+    }
+
+    auto GuestStart = static_cast<uint8_t const*>(static_cast<void*>(Guest->msg_control));
+    auto GuestEnd = GuestStart + Guest->msg_controllen;
+
+    // Walks the guest's messages, returns the host space they need and converts them if there is somewhere to put them
+    auto Convert = [&](uint8_t *HostData) -> size_t {
+      size_t HostOffset = 0;
+      for (auto Ptr = GuestStart; Ptr + sizeof(cmsghdr32) <= GuestEnd;) {
+        auto Msg = reinterpret_cast<cmsghdr32 const*>(Ptr);
+        if (Msg->cmsg_len < sizeof(cmsghdr32) ||
+            Msg->cmsg_len > static_cast<size_t>(GuestEnd - Ptr)) {
+          break;
+        }
+
+        size_t DataSize = Msg->cmsg_len - sizeof(cmsghdr32);
+        if (HostData) {
+          auto HostMsg = reinterpret_cast<cmsghdr*>(HostData + HostOffset);
+          HostMsg->cmsg_len = CMSG_LEN(DataSize);
+          HostMsg->cmsg_level = Msg->cmsg_level;
+          HostMsg->cmsg_type = Msg->cmsg_type;
+          memcpy(CMSG_DATA(HostMsg), Msg->cmsg_data, DataSize);
+        }
+
+        HostOffset += CMSG_SPACE(DataSize);
+        Ptr += GuestCMsgAlign(Msg->cmsg_len);
+      }
+      return HostOffset;
+    };
+
+    size_t HostSize = Convert(nullptr);
+    if (!HostSize) {
+      return;
+    }
+
+    auto HostData = Scratch.Allocate<uint8_t>(HostSize);
+    memset(HostData, 0, HostSize);
+    Convert(HostData);
+
+    Host->msg_control = HostData;
+    Host->msg_controllen = HostSize;
+  }
+
+  // The host has already opened any fds passed with SCM_RIGHTS, so a message the guest never sees has to close them
+  void CloseDroppedRights(cmsghdr *cmsg) {
+    if (cmsg->cmsg_level != SOL_SOCKET ||
+        cmsg->cmsg_type != SCM_RIGHTS) {
+      return;
+    }
+
+    size_t Count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    auto FDs = reinterpret_cast<int*>(CMSG_DATA(cmsg));
+    for (size_t i = 0; i < Count; ++i) {
+      ::close(FDs[i]);
+    }
+  }
+
+  void ControlFromHost(msghdr *Host, msghdr32 *Guest) {
+    if (!Guest->msg_control) {
+      Guest->msg_controllen = 0;
+      return;
+    }
+
+    auto GuestStart = static_cast<uint8_t*>(static_cast<void*>(Guest->msg_control));
+    size_t GuestSize = Guest->msg_controllen;
+    size_t GuestOffset = 0;
+
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(Host);
+        cmsg != nullptr;
+        cmsg = CMSG_NXTHDR(Host, cmsg)) {
+      size_t DataSize = cmsg->cmsg_len - CMSG_LEN(0);
+      size_t GuestLen = sizeof(cmsghdr32) + DataSize;
+
+      // Same as the kernel, whatever doesn't fit is dropped and the guest is told
+      if (GuestOffset + GuestLen > GuestSize) {
+        Guest->msg_flags |= MSG_CTRUNC;
+        for (; cmsg != nullptr; cmsg = CMSG_NXTHDR(Host, cmsg)) {
+          CloseDroppedRights(cmsg);
+        }
+        break;
+      }
+
+      auto CurrentGuest = reinterpret_cast<cmsghdr32*>(GuestStart + GuestOffset);
+      CurrentGuest->cmsg_len = GuestLen;
+      CurrentGuest->cmsg_level = cmsg->cmsg_level;
+      CurrentGuest->cmsg_type = cmsg->cmsg_type;
+      memcpy(CurrentGuest->cmsg_data, CMSG_DATA(cmsg), DataSize);
+
+      GuestOffset += std::min(GuestCMsgAlign(GuestLen), GuestSize - GuestOffset);
+    }
+
+    Guest->msg_controllen = GuestOffset;
+  }
+
   void RegisterSocket() {
     REGISTER_SYSCALL_IMPL_X32(socketcall, [](FEXCore::Core::InternalThreadState *Thread, uint32_t call, uint32_t *Arguments) -> uint64_t {
       uint64_t Result{};
@@ -124,20 +232,19 @@ namespace FEX::HLE::x32 {
         case OP_SENDMSG: {
           const struct msghdr32 *guest_msg = reinterpret_cast<const struct msghdr32*>(Arguments[1]);
 
-          struct msghdr HostHeader{};
-          std::vector<iovec> Host_iovec(guest_msg->msg_iovlen);
-          for (int i = 0; i < guest_msg->msg_iovlen; ++i) {
-            Host_iovec[i] = guest_msg->msg_iov[i];
+          if (guest_msg->msg_iovlen > IOV_MAX) {
+            return -EMSGSIZE;
           }
 
+          ScratchArena::Scope Scratch;
+          struct msghdr HostHeader{};
           HostHeader.msg_name = guest_msg->msg_name;
           HostHeader.msg_namelen = guest_msg->msg_namelen;
 
-          HostHeader.msg_iov = &Host_iovec.at(0);
+          HostHeader.msg_iov = ToHost<iovec>(Scratch, static_cast<iovec32*>(guest_msg->msg_iov), guest_msg->msg_iovlen);
           HostHeader.msg_iovlen = guest_msg->msg_iovlen;
 
-          HostHeader.msg_control = guest_msg->msg_control;
-          HostHeader.msg_controllen = guest_msg->msg_controllen;
+          ControlToHost(Scratch, guest_msg, &HostHeader);
 
           HostHeader.msg_flags = guest_msg->msg_flags;
 
@@ -147,55 +254,29 @@ namespace FEX::HLE::x32 {
         case OP_RECVMSG: {
           struct msghdr32 *guest_msg = reinterpret_cast<struct msghdr32*>(Arguments[1]);
 
-          struct msghdr HostHeader{};
-          std::vector<iovec> Host_iovec(guest_msg->msg_iovlen);
-          for (int i = 0; i < guest_msg->msg_iovlen; ++i) {
-            Host_iovec[i] = guest_msg->msg_iov[i];
+          if (guest_msg->msg_iovlen > IOV_MAX) {
+            return -EMSGSIZE;
           }
 
+          ScratchArena::Scope Scratch;
+          struct msghdr HostHeader{};
           HostHeader.msg_name = guest_msg->msg_name;
           HostHeader.msg_namelen = guest_msg->msg_namelen;
 
-          HostHeader.msg_iov = &Host_iovec.at(0);
+          HostHeader.msg_iov = ToHost<iovec>(Scratch, static_cast<iovec32*>(guest_msg->msg_iov), guest_msg->msg_iovlen);
           HostHeader.msg_iovlen = guest_msg->msg_iovlen;
 
-          HostHeader.msg_control = alloca(guest_msg->msg_controllen);
-          HostHeader.msg_controllen = guest_msg->msg_controllen;
+          // Host control messages are larger, twice the guest's space holds anything the guest could have taken
+          HostHeader.msg_controllen = guest_msg->msg_control ? guest_msg->msg_controllen * 2 : 0;
+          HostHeader.msg_control = HostHeader.msg_controllen ? Scratch.Allocate<uint8_t>(HostHeader.msg_controllen) : nullptr;
 
           HostHeader.msg_flags = guest_msg->msg_flags;
 
           Result = ::recvmsg(Arguments[0], &HostHeader, Arguments[2]);
           if (Result != -1) {
-            for (int i = 0; i < guest_msg->msg_iovlen; ++i) {
-              guest_msg->msg_iov[i] = Host_iovec[i];
-            }
-
             guest_msg->msg_namelen = HostHeader.msg_namelen;
-            guest_msg->msg_controllen = HostHeader.msg_controllen;
             guest_msg->msg_flags = HostHeader.msg_flags;
-            if (HostHeader.msg_controllen) {
-              // Host and guest cmsg data structures aren't compatible.
-              // Copy them over now
-              void *CurrentGuestPtr = guest_msg->msg_control;
-              for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&HostHeader);
-                  cmsg != nullptr;
-                  cmsg = CMSG_NXTHDR(&HostHeader, cmsg)) {
-                cmsghdr32 *CurrentGuest = reinterpret_cast<cmsghdr32*>(CurrentGuestPtr);
-
-                // Copy over the header first
-                // cmsg_len needs to be adjusted by the size of the header between host and guest
-                // Host is 16 bytes, guest is 12 bytes
-                CurrentGuest->cmsg_len = cmsg->cmsg_len - (CMSG_LEN(0) - sizeof(cmsghdr32));
-                CurrentGuest->cmsg_level = cmsg->cmsg_level;
-                CurrentGuest->cmsg_type = cmsg->cmsg_type;
-
-                // Now copy over the data
-                if (cmsg->cmsg_len) {
-                  memcpy(CurrentGuest->cmsg_data, CMSG_DATA(cmsg), cmsg->cmsg_len);
-                  CurrentGuestPtr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(CurrentGuestPtr) + cmsg->cmsg_len);
-                }
-              }
-            }
+            ControlFromHost(&HostHeader, guest_msg);
           }
           break;
         }
@@ -2,6 +2,7 @@
 #include "Tests/LinuxSyscalls/x64/Syscalls.h"
 
 #include <linux/aio_abi.h>
+#include <linux/io_uring.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 
@@ -16,5 +17,23 @@ namespace FEX::HLE::x64 {
       uint64_t Result = ::syscall(SYS_io_pgetevents, ctx_id, min_nr, nr, events, timeout);
       SYSCALL_ERRNO();
     });
+
+    // The rings are mapped by the guest through a regular mmap of the returned fd, so they are shared with the kernel as-is
+    // io_uring_params and the ring entries are made of fixed size fields, which the guest and host agree on
+    // See EPoll.cpp for the one operation whose pointed to structure doesn't match on every host
+    REGISTER_SYSCALL_IMPL_X64(io_uring_setup, [](FEXCore::Core::InternalThreadState *Thread, uint32_t entries, struct io_uring_params *p) -> uint64_t {
+      uint64_t Result = ::syscall(SYS_io_uring_setup, entries, p);
+      SYSCALL_ERRNO();
+    });
+
+    REGISTER_SYSCALL_IMPL_X64(io_uring_enter, [](FEXCore::Core::InternalThreadState *Thread, unsigned int fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags, void *argp, size_t argsz) -> uint64_t {
+      uint64_t Result = ::syscall(SYS_io_uring_enter, fd, to_submit, min_complete, flags, argp, argsz);
+      SYSCALL_ERRNO();
+    });
+
+    REGISTER_SYSCALL_IMPL_X64(io_uring_register, [](FEXCore::Core::InternalThreadState *Thread, unsigned int fd, unsigned int opcode, void *arg, uint32_t nr_args) -> uint64_t {
+      uint64_t Result = ::syscall(SYS_io_uring_register, fd, opcode, arg, nr_args);
+      SYSCALL_ERRNO();
+    });
   }
 }
@@ -145,6 +145,26 @@ namespace FEX::HLE::x64 {
 #endif
     }
 
+#ifdef _M_X86_64
+    // Guest and host are the same ABI, these are straight passthroughs without any FEX side state
+    // Let the JIT issue them directly
+    //
+    // InlineSyscall skips HandleSyscall entirely, which is only safe because the handlers for these add nothing:
+    // - Errno: the handlers are `::read(...)` plus SYSCALL_ERRNO, which just turns the -1/errno pair back in to the
+    //   kernel's -errno. The raw kernel return is the same value.
+    // - Signals: the guest signal mask is emulated by the SignalDelegator, not loaded in to the host mask, and
+    //   neither HandleSyscall nor these handlers change it or check for pending signals afterwards.
+    //   A host signal arriving during a blocking read or futex wait interrupts the same host syscall either way,
+    //   so the guest sees the same -EINTR or restart.
+    // - Descriptors and memory: FEX doesn't track or translate fds, buffers, futex words or timespecs for these,
+    //   the guest pointers are host pointers.
+    // Anything that needs FEX state (fd tables, emulated files, thread management) must stay off this list.
+    // clock_gettime stays off as well, its handler goes through the host's vDSO which is cheaper than a host syscall.
+    for (int Syscall : {SYSCALL_x64_read, SYSCALL_x64_write, SYSCALL_x64_futex}) {
+      Definitions.at(Syscall).HostSyscallNumber = Syscall;
+    }
+#endif
+
 #if PRINT_MISSING_SYSCALLS
     for (auto &Syscall: SyscallNames) {
       if (Definitions[Syscall.first].Ptr == cvt(&Unimplemented)) {
@@ -74,6 +74,11 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::Value<bool> SMCChecksConfig{FEXCore::Config::CONFIG_SMC_CHECKS, false};
   FEXCore::Config::Value<bool> ABILocalFlags{FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS, false};
   FEXCore::Config::Value<bool> AbiNoPF{FEXCore::Config::CONFIG_ABI_NO_PF, false};
+  FEXCore::Config::Value<bool> X87SoftFloat{FEXCore::Config::CONFIG_X87SOFTFLOAT, false};
+  FEXCore::Config::Value<uint8_t> OptLevel{FEXCore::Config::CONFIG_OPT_LEVEL, 1};
+  FEXCore::Config::Value<std::string> PassPipeline{FEXCore::Config::CONFIG_PASS_PIPELINE, ""};
+  FEXCore::Config::Value<bool> PrivateStack{FEXCore::Config::CONFIG_PRIVATE_STACK, false};
+  FEXCore::Config::Value<std::string> HostFeatures{FEXCore::Config::CONFIG_HOSTFEATURES, ""};
 
   auto Args = FEX::ArgLoader::Get();
 
@@ -93,6 +98,11 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_SMC_CHECKS, SMCChecksConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS, ABILocalFlags());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ABI_NO_PF, AbiNoPF());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_X87SOFTFLOAT, X87SoftFloat());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_OPT_LEVEL, OptLevel());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_PIPELINE, PassPipeline());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PRIVATE_STACK, PrivateStack());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOSTFEATURES, HostFeatures());
   FEXCore::Context::SetCustomCPUBackendFactory(CTX, HostFactory::CPUCreationFactory);
 
   FEXCore::Context::InitializeContext(CTX);
@@ -6,6 +6,7 @@
 #include "Common/Config.h"
 #include "Common/StringUtil.h"
 #include "Util/DataRingBuffer.h"
+#include "IRLoader/Loader.h"
 
 #include <chrono>
 #include <FEXCore/Config/Config.h>
@@ -222,6 +223,13 @@ namespace CPUStats {
         ImGui::Text("%f", BlocksCompiled.back());
       }
 
+      if (FEX::DebuggerState::ActiveCore()) {
+        auto RuntimeStats = FEXCore::Context::Debug::GetRuntimeStatsForThread(FEX::DebuggerState::GetContext(), CPUState::CurrentThreadSelected);
+        ImGui::Text("Code cache flushes: %ld, Generations evicted: %ld", RuntimeStats->CodeCacheFlushes.load(), RuntimeStats->CodeGenerationsEvicted.load());
+        ImGui::Text("Blocks evicted: %ld, Blocks recompiled: %ld", RuntimeStats->BlocksEvicted.load(), RuntimeStats->BlocksRecompiled.load());
+        ImGui::Text("Block cache pages evicted: %ld", RuntimeStats->BlockCachePagesEvicted.load());
+      }
+
     }
     ImGui::End();
   }
@@ -464,6 +472,8 @@ namespace IR {
   };
 
   bool HadSelectedSaveIR{};
+  // Pass pipeline that loaded IR files are run through. Empty uses the context's configured pipeline
+  char PassPipeline[256]{};
   ImGuiFs::Dialog Dialog;
   FEX::Debugger::IR::Lexer Lexer;
   std::vector<FEXImGui::IRLines> IRLines;
@@ -607,6 +617,8 @@ namespace IR {
 
     if (ImGui::Begin("#IR Viewer", &ShowCPUIR)) {
       HadSelectedSaveIR = ImGui::Button("Save IR");
+      ImGui::SameLine();
+      ImGui::InputText("Passes", PassPipeline, sizeof(PassPipeline));
       FEXImGui::CustomIRViewer(Logging::IRData.c_str(), Logging::IRData.size(), &IRLines);
     }
     ImGui::End();
@@ -635,20 +647,22 @@ namespace IR {
   }
 
   void LoadIR(char const *Filename) {
-    IRFileHeader Header;
-    std::fstream IRFile;
-    IRFile.open(Filename, std::fstream::in | std::fstream::binary);
-    LogMan::Throw::A(IRFile.is_open(), "Failed to open file");
-
-    IRFile.read(reinterpret_cast<char*>(&Header), sizeof(Header));
-
-    // FEXCore::IR::IntrusiveIRList IR(Header.IRSize);
-    // char *Ptr = IR.SetupForLoad<char>(Header.IRSize);
-    // IRFile.read(Ptr, Header.IRSize);
-    // IRFile.close();
-    // FEXCore::Context::Debug::SetIRForRIP(FEX::DebuggerState::GetContext(), Header.RIP, &IR);
-    // FEX::DebuggerState::SetHasNewState();
-    // FEX::DebuggerState::CallNewState();
+    FEX::IRLoader::Loader Loader(Filename, {});
+    if (!Loader.IsValid()) {
+      LogMan::Msg::E("Couldn't load IR from '%s'", Filename);
+      return;
+    }
+
+    if (!FEXCore::Context::Debug::RunPassPipeline(FEX::DebuggerState::GetContext(), &Loader, PassPipeline)) {
+      LogMan::Msg::E("Pass pipeline '%s' was rejected, ran the default pipeline instead", PassPipeline);
+    }
+
+    auto IR = Loader.ViewIR();
+    std::stringstream out;
+    FEXCore::IR::Dump(&out, &IR, nullptr);
+    Logging::IRData = out.str();
+    IRLines.clear();
+    ShowCPUIR = true;
   }
 
   void NewState() {
@@ -42,7 +42,16 @@ void StepCallback() {
 void CreateCoreCallback(char const *Filename, bool ELF) {
   CTX = FEXCore::Context::CreateNewContext();
 
+  FEXCore::Config::Value<uint8_t> OptLevel{FEXCore::Config::CONFIG_OPT_LEVEL, 1};
+  FEXCore::Config::Value<std::string> PassPipeline{FEXCore::Config::CONFIG_PASS_PIPELINE, ""};
+  FEXCore::Config::Value<bool> PrivateStack{FEXCore::Config::CONFIG_PRIVATE_STACK, false};
+  FEXCore::Config::Value<std::string> HostFeatures{FEXCore::Config::CONFIG_HOSTFEATURES, ""};
+
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_DEFAULTCORE, FEX::DebuggerState::GetCoreType());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_OPT_LEVEL, OptLevel());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_PIPELINE, PassPipeline());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PRIVATE_STACK, PrivateStack());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOSTFEATURES, HostFeatures());
 
   FEXCore::Context::InitializeContext(CTX);
 
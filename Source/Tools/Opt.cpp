@@ -1,14 +1,241 @@
 #include "Common/ArgumentLoader.h"
 #include "Common/EnvironmentLoader.h"
 #include "Common/Config.h"
+#include "IRLoader/Loader.h"
 
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Debug/ContextDebug.h>
+#include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
+  const char *CharLevel{nullptr};
+
+  switch (Level) {
+  case LogMan::NONE:
+    CharLevel = "NONE";
+    break;
+  case LogMan::ASSERT:
+    CharLevel = "ASSERT";
+    break;
+  case LogMan::ERROR:
+    CharLevel = "ERROR";
+    break;
+  case LogMan::DEBUG:
+    CharLevel = "DEBUG";
+    break;
+  case LogMan::INFO:
+    CharLevel = "Info";
+    break;
+  case LogMan::STDOUT:
+    CharLevel = "STDOUT";
+    break;
+  case LogMan::STDERR:
+    CharLevel = "STDERR";
+    break;
+  default:
+    CharLevel = "???";
+    break;
+  }
+
+  fprintf(stderr, "[%s] %s\n", CharLevel, Message);
+}
+
+void AssertHandler(char const *Message) {
+  fprintf(stderr, "[ASSERT] %s\n", Message);
+}
+
+namespace {
+  struct BlockCorpus {
+    std::string Filename;
+    std::vector<std::string> Lines;
+  };
+
+  // Splits a DumpIR file in to its blocks
+  // DumpIR wraps each block with a `IR-pre 0x<RIP>:` header and a `@@@@@` footer
+  // Post-RA blocks are skipped since they can't be fed back through RA
+  // Files without any markers are treated as a single block
+  void LoadIRFile(std::string const &Filename, std::vector<BlockCorpus> *Corpus) {
+    std::ifstream File(Filename);
+    if (!File.is_open()) {
+      LogMan::Msg::E("Couldn't open IR file '%s'", Filename.c_str());
+      return;
+    }
+
+    BlockCorpus Current{Filename, {}};
+    bool SkipBlock{};
+    auto FinishBlock = [&]() {
+      if (!SkipBlock && !Current.Lines.empty()) {
+        Corpus->emplace_back(std::move(Current));
+      }
+      Current = {Filename, {}};
+      SkipBlock = false;
+    };
+
+    std::string Line;
+    while (std::getline(File, Line)) {
+      if (Line.starts_with("IR-") || Line.starts_with("IR ")) {
+        FinishBlock();
+        SkipBlock = Line.starts_with("IR-post");
+        continue;
+      }
+
+      if (Line == "@@@@@") {
+        FinishBlock();
+        continue;
+      }
+
+      Current.Lines.emplace_back(std::move(Line));
+    }
+
+    FinishBlock();
+  }
+
+  void LoadCorpus(std::string const &Path, std::vector<BlockCorpus> *Corpus) {
+    if (!std::filesystem::is_directory(Path)) {
+      LoadIRFile(Path, Corpus);
+      return;
+    }
+
+    // Sort the files so the block order is stable between runs
+    std::vector<std::string> Files;
+    for (auto &Entry : std::filesystem::recursive_directory_iterator(Path)) {
+      auto Filename = Entry.path().string();
+      if (Entry.is_regular_file() &&
+          Filename.ends_with(".ir") &&
+          !Filename.ends_with("-post.ir")) {
+        Files.emplace_back(Filename);
+      }
+    }
+
+    std::sort(Files.begin(), Files.end());
+    for (auto &Filename : Files) {
+      LoadIRFile(Filename, Corpus);
+    }
+  }
+}
 
 int main(int argc, char **argv, char **const envp) {
+  LogMan::Throw::InstallHandler(AssertHandler);
+  LogMan::Msg::InstallHandler(MsgHandler);
+
   FEXCore::Config::Initialize();
   FEXCore::Config::AddLayer(std::make_unique<FEX::Config::MainLoader>());
   FEXCore::Config::AddLayer(std::make_unique<FEX::ArgLoader::ArgLoader>(argc, argv));
   FEXCore::Config::AddLayer(std::make_unique<FEX::Config::EnvLoader>(envp));
   FEXCore::Config::Load();
 
+  FEXCore::Config::Value<uint8_t> CoreConfig{FEXCore::Config::CONFIG_DEFAULTCORE, 0};
+  FEXCore::Config::Value<uint8_t> OptLevel{FEXCore::Config::CONFIG_OPT_LEVEL, 1};
+  FEXCore::Config::Value<std::string> PassPipeline{FEXCore::Config::CONFIG_PASS_PIPELINE, ""};
+  FEXCore::Config::Value<bool> PrivateStack{FEXCore::Config::CONFIG_PRIVATE_STACK, false};
+  FEXCore::Config::Value<std::string> HostFeatures{FEXCore::Config::CONFIG_HOSTFEATURES, ""};
+  FEXCore::Config::Value<std::string> DumpIR{FEXCore::Config::CONFIG_DUMPIR, "no"};
+
+  auto Args = FEX::ArgLoader::Get();
+
+  if (Args.empty()) {
+    LogMan::Msg::E("Usage: Opt [-c irint|irjit] [-O <level>] [--passes <pass,...>] [--dump-ir stdout] <IR file or DumpIR folder>...");
+    LogMan::Msg::E("Passes always run, -c irjit also runs RA and emits host code");
+    return -1;
+  }
+
+  if (CoreConfig() != FEXCore::Config::CONFIG_INTERPRETER &&
+      CoreConfig() != FEXCore::Config::CONFIG_IRJIT) {
+    LogMan::Msg::E("Opt only supports the irint and irjit cores");
+    return -1;
+  }
+
+  std::vector<BlockCorpus> Corpus;
+  for (auto &Path : Args) {
+    LoadCorpus(Path, &Corpus);
+  }
+
+  // The pipeline is built for the selected core, so -c irint measures what the interpreter would run
+  // RA only runs for the JIT, interpreter blocks never report spills
+  bool JITCompile = CoreConfig() == FEXCore::Config::CONFIG_IRJIT;
+
+  FEXCore::Context::InitializeStaticTables();
+  auto CTX = FEXCore::Context::CreateNewContext();
+
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_DEFAULTCORE, CoreConfig());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_OPT_LEVEL, OptLevel());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_PIPELINE, PassPipeline());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PRIVATE_STACK, PrivateStack());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOSTFEATURES, HostFeatures());
+
+  FEXCore::Context::InitializeContext(CTX);
+
+  FEX::IRLoader::InitializeStaticTables();
+
+  FEXCore::Context::Debug::CompileStats Total{};
+  uint64_t TotalSpills{};
+  uint64_t TotalFills{};
+  uint64_t Compiled{};
+  uint64_t Failed{};
+
+  for (auto &Block : Corpus) {
+    FEX::IRLoader::Loader Loader(std::move(Block.Lines));
+
+    if (!Loader.IsValid()) {
+      LogMan::Msg::E("Couldn't load IR block from '%s'", Block.Filename.c_str());
+      ++Failed;
+      continue;
+    }
+
+    FEXCore::Context::Debug::CompileStats Stats{};
+    FEXCore::Context::Debug::CompileIR(CTX, &Loader, JITCompile, &Stats);
+
+    auto IR = Loader.ViewIR();
+    uint32_t Spills{};
+    uint32_t Fills{};
+    for (auto [BlockNode, BlockHeader] : IR.GetBlocks()) {
+      for (auto [CodeNode, IROp] : IR.GetCode(BlockNode)) {
+        if (IROp->Op == FEXCore::IR::OP_SPILLREGISTER) {
+          ++Spills;
+        }
+        else if (IROp->Op == FEXCore::IR::OP_FILLREGISTER) {
+          ++Fills;
+        }
+      }
+    }
+
+    printf("0x%lx: %zu ssa, passes %lu ns, compile %lu ns, %lu bytes, %u spill bytes, %u spills, %u fills\n",
+      Loader.GetEntryRIP(), IR.GetSSACount(),
+      Stats.PassTime, Stats.CompileTime, Stats.HostCodeSize,
+      Stats.SpillSlots * 8, Spills, Fills);
+
+    if (DumpIR() == "stdout") {
+      std::stringstream out;
+      FEXCore::IR::Dump(&out, &IR, nullptr);
+      printf("%s\n@@@@@\n", out.str().c_str());
+    }
+
+    Total.PassTime += Stats.PassTime;
+    Total.CompileTime += Stats.CompileTime;
+    Total.HostCodeSize += Stats.HostCodeSize;
+    Total.SpillSlots += Stats.SpillSlots;
+    TotalSpills += Spills;
+    TotalFills += Fills;
+    ++Compiled;
+  }
+
+  printf("Total: %lu blocks (%lu failed to load), passes %lu ns, compile %lu ns, %lu bytes, %u spill bytes, %lu spills, %lu fills\n",
+    Compiled, Failed,
+    Total.PassTime, Total.CompileTime, Total.HostCodeSize,
+    Total.SpillSlots * 8, TotalSpills, TotalFills);
+
+  FEXCore::Context::DestroyContext(CTX);
+
+  return Failed ? -1 : 0;
 }
@@ -0,0 +1,220 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0",
+    "RBX": "0x1"
+  },
+  "Mode": "32BIT"
+}
+%endif
+
+; Checks the guest allocator against the mmap pattern of a fragmenting 32bit workload
+; Map a spread of sizes, punch holes, refill them with different sizes, grow with mremap,
+; split with MAP_FIXED then tear it all down, several times over
+; RAX is how many calls failed or lost data, RBX is whether a final mapping still works
+
+%define PTRS    0xe0000000
+%define LENGTHS 0xe0001000
+%define ERRORS  0xe0002000
+%define ROUND   0xe0002004
+%define INDEX   0xe0002008
+
+%define COUNT  256
+; Scripts/mmap_fragmentation_bench.py raises this to time the allocator
+%ifndef ROUNDS
+%define ROUNDS 8
+%endif
+
+%define SYS_munmap 91
+%define SYS_mremap 163
+%define SYS_mmap2  192
+
+mov dword [ERRORS], 0
+mov dword [ROUND], ROUNDS
+
+round:
+
+; Map everything, every 16th is a large one
+mov dword [INDEX], 0
+map_loop:
+  mov edi, [INDEX]
+  mov ecx, edi
+  imul ecx, ecx, 7
+  and ecx, 15
+  inc ecx
+  test edi, 15
+  jnz map_small
+  mov ecx, 64
+map_small:
+  shl ecx, 12
+  mov [LENGTHS + edi * 4], ecx
+
+  mov eax, SYS_mmap2
+  xor ebx, ebx
+  mov edx, 3 ; PROT_READ | PROT_WRITE
+  mov esi, 0x22 ; MAP_PRIVATE | MAP_ANONYMOUS
+  mov edi, -1
+  xor ebp, ebp
+  int 0x80
+
+  mov edi, [INDEX]
+  mov [PTRS + edi * 4], eax
+  cmp eax, 0xfffff000
+  jbe map_ok
+  inc dword [ERRORS]
+  mov dword [PTRS + edi * 4], 0
+  jmp map_next
+map_ok:
+  mov [eax], edi
+map_next:
+  inc edi
+  mov [INDEX], edi
+  cmp edi, COUNT
+  jne map_loop
+
+; Unmap the odd ones to fragment the space
+mov dword [INDEX], 1
+hole_loop:
+  mov edi, [INDEX]
+  mov eax, SYS_munmap
+  mov ebx, [PTRS + edi * 4]
+  mov ecx, [LENGTHS + edi * 4]
+  int 0x80
+  test eax, eax
+  jz hole_next
+  inc dword [ERRORS]
+hole_next:
+  mov edi, [INDEX]
+  add edi, 2
+  mov [INDEX], edi
+  cmp edi, COUNT
+  jb hole_loop
+
+; Refill the holes with sizes that mostly don't match them
+mov dword [INDEX], 1
+refill_loop:
+  mov edi, [INDEX]
+  mov ecx, edi
+  imul ecx, ecx, 5
+  and ecx, 31
+  inc ecx
+  shl ecx, 12
+  mov [LENGTHS + edi * 4], ecx
+
+  mov eax, SYS_mmap2
+  xor ebx, ebx
+  mov edx, 3 ; PROT_READ | PROT_WRITE
+  mov esi, 0x22 ; MAP_PRIVATE | MAP_ANONYMOUS
+  mov edi, -1
+  xor ebp, ebp
+  int 0x80
+
+  mov edi, [INDEX]
+  mov [PTRS + edi * 4], eax
+  cmp eax, 0xfffff000
+  jbe refill_ok
+  inc dword [ERRORS]
+  mov dword [PTRS + edi * 4], 0
+  jmp refill_next
+refill_ok:
+  mov [eax], edi
+refill_next:
+  add edi, 2
+  mov [INDEX], edi
+  cmp edi, COUNT
+  jb refill_loop
+
+; Grow the even ones, in place or moved, the contents have to come along
+mov dword [INDEX], 0
+grow_loop:
+  mov edi, [INDEX]
+  mov eax, SYS_mremap
+  mov ebx, [PTRS + edi * 4]
+  mov ecx, [LENGTHS + edi * 4]
+  lea edx, [ecx + 8 * 4096]
+  mov esi, 1 ; MREMAP_MAYMOVE
+  int 0x80
+
+  mov edi, [INDEX]
+  cmp eax, 0xfffff000
+  jbe grow_ok
+  inc dword [ERRORS]
+  jmp grow_next
+grow_ok:
+  mov [PTRS + edi * 4], eax
+  add dword [LENGTHS + edi * 4], 8 * 4096
+  cmp [eax], edi
+  je grow_next
+  inc dword [ERRORS]
+grow_next:
+  add edi, 2
+  mov [INDEX], edi
+  cmp edi, COUNT
+  jb grow_loop
+
+; Split the large ones by mapping a fixed page over their second page
+mov dword [INDEX], 0
+split_loop:
+  mov edi, [INDEX]
+  mov ebx, [PTRS + edi * 4]
+  add ebx, 4096
+  push ebx
+  mov eax, SYS_mmap2
+  mov ecx, 4096
+  mov edx, 3 ; PROT_READ | PROT_WRITE
+  mov esi, 0x32 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED
+  mov edi, -1
+  xor ebp, ebp
+  int 0x80
+  pop ebx
+
+  cmp eax, ebx
+  je split_next
+  inc dword [ERRORS]
+split_next:
+  mov edi, [INDEX]
+  add edi, 16
+  mov [INDEX], edi
+  cmp edi, COUNT
+  jb split_loop
+
+; Tear it all down
+mov dword [INDEX], 0
+unmap_loop:
+  mov edi, [INDEX]
+  mov eax, SYS_munmap
+  mov ebx, [PTRS + edi * 4]
+  mov ecx, [LENGTHS + edi * 4]
+  int 0x80
+  test eax, eax
+  jz unmap_next
+  inc dword [ERRORS]
+unmap_next:
+  mov edi, [INDEX]
+  inc edi
+  mov [INDEX], edi
+  cmp edi, COUNT
+  jne unmap_loop
+
+dec dword [ROUND]
+jnz round
+
+; Everything went back to the allocator, a new mapping has to work
+mov eax, SYS_mmap2
+xor ebx, ebx
+mov ecx, 4096
+mov edx, 3 ; PROT_READ | PROT_WRITE
+mov esi, 0x22 ; MAP_PRIVATE | MAP_ANONYMOUS
+mov edi, -1
+xor ebp, ebp
+int 0x80
+
+xor ebx, ebx
+cmp eax, 0xfffff000
+ja done
+mov dword [eax], 1
+mov ebx, [eax]
+done:
+mov eax, [ERRORS]
+
+hlt
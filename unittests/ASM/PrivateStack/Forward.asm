@@ -0,0 +1,27 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x4142434445464748",
+    "RBX": "0x4142434445464748",
+    "RCX": "0x0000000045464748",
+    "RDX": "0x0000000000004748"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0x100000800
+mov rax, 0x4142434445464748
+
+; A pop of the slot that was just pushed sees the pushed value
+push rax
+pop rbx
+
+; Narrower loads of a slot see the truncated value
+mov [rsp - 16], rax
+mov ecx, [rsp - 16]
+movzx edx, word [rsp - 16]
+
+hlt
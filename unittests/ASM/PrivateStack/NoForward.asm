@@ -0,0 +1,35 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x1111111111111111",
+    "RBX": "0x2222222222222222",
+    "RCX": "0x2222222222222222",
+    "RDX": "0x3333333311111111",
+    "RSI": "0x0000000100000000",
+    "RDI": "0x0000000100000800"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0x100000800
+mov rsi, 0x100000000
+mov rax, 0x1111111111111111
+mov rcx, 0x2222222222222222
+
+; The stack pointer escapes to memory and comes back as a pointer the pass can't relate to the stack
+mov [rsi], rsp
+push rax
+mov rdi, [rsi]
+; Overwrites the pushed slot, the pop must not see rax
+mov [rdi - 8], rcx
+pop rbx
+
+; A narrower store in to the middle of a slot invalidates it
+push rax
+mov dword [rsp + 4], 0x33333333
+pop rdx
+
+hlt
@@ -0,0 +1,112 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xfffffffffffffffe",
+    "RBX": "0x0000000000000000",
+    "RCX": "0x0000000000000000",
+    "RDX": "0x0000000000000000",
+    "RSI": "0xfffffffffffffffe"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; Runs with /tmp as the RootFS
+; A lookup that missed in the RootFS is cached, creating the file afterwards has to make it visible
+; The lookups use `//name` while the creation uses `/name` and the removal the host path, so the cache can't rely on spelling
+mov r15, 0x100000000
+
+; getpid()
+mov rax, 39
+syscall
+
+; "fexrc_" followed by the pid as letters, so parallel runs don't share a file
+lea rdi, [r15 + 0x300]
+mov dword [rdi], 0x72786566
+mov word [rdi + 4], 0x5f63
+add rdi, 6
+mov ecx, 8
+name_loop:
+mov edx, eax
+and edx, 0xf
+add edx, 0x61
+mov [rdi], dl
+inc rdi
+shr eax, 4
+dec ecx
+jnz name_loop
+mov byte [rdi], 0
+
+; "/name"
+mov byte [r15], 0x2f
+lea rsi, [r15 + 0x300]
+lea rdi, [r15 + 1]
+mov ecx, 15
+rep movsb
+
+; "//name"
+mov word [r15 + 0x40], 0x2f2f
+lea rsi, [r15 + 0x300]
+lea rdi, [r15 + 0x42]
+mov ecx, 15
+rep movsb
+
+; "/tmp/name"
+mov dword [r15 + 0x80], 0x706d742f
+mov byte [r15 + 0x84], 0x2f
+lea rsi, [r15 + 0x300]
+lea rdi, [r15 + 0x85]
+mov ecx, 15
+rep movsb
+
+; stat("//name") = -ENOENT, caches the miss
+mov rax, 4
+lea rdi, [r15 + 0x40]
+lea rsi, [r15 + 0x400]
+syscall
+mov [r15 + 0x200], rax
+
+; openat(AT_FDCWD, "/name", O_WRONLY | O_CREAT, 0644) creates it in the RootFS
+mov rax, 257
+mov rdi, -100
+mov rsi, r15
+mov rdx, 0x41
+mov r10, 0x1a4
+syscall
+mov rdi, rax
+shr rax, 63
+mov [r15 + 0x208], rax
+
+; close(fd)
+mov rax, 3
+syscall
+
+; stat("//name") = 0
+mov rax, 4
+lea rdi, [r15 + 0x40]
+lea rsi, [r15 + 0x400]
+syscall
+mov [r15 + 0x210], rax
+
+; unlink("/tmp/name") = 0
+mov rax, 87
+lea rdi, [r15 + 0x80]
+syscall
+mov [r15 + 0x218], rax
+
+; stat("//name") = -ENOENT again
+mov rax, 4
+lea rdi, [r15 + 0x40]
+lea rsi, [r15 + 0x400]
+syscall
+mov [r15 + 0x220], rax
+
+mov rax, [r15 + 0x200]
+mov rbx, [r15 + 0x208]
+mov rcx, [r15 + 0x210]
+mov rdx, [r15 + 0x218]
+mov rsi, [r15 + 0x220]
+
+hlt
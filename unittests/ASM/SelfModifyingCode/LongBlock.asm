@@ -0,0 +1,32 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0xFFFFFFFFFFFFFFFF",
+    "RBX": "0x4142434445464748",
+    "RDX": "0x2"
+  }
+}
+%endif
+
+jmp main
+
+; 22 bytes, so the last 16 byte chunk overlaps the first one
+patched_block:
+mov rax, -1                 ; 7 bytes
+mov rbx, 0x4142434445464748 ; 10 bytes
+patched_op:
+mov edx, 1                  ; 5 bytes
+ret
+
+main:
+
+; warm up the cache
+call patched_block
+
+; only the immediate of the last instruction changes, which only the last chunk covers
+mov byte [rel patched_op + 1], 2
+
+call patched_block
+
+hlt
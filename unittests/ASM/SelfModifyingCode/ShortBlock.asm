@@ -0,0 +1,26 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RDX": "0x2"
+  }
+}
+%endif
+
+jmp main
+
+; 6 bytes, shorter than a single 16 byte compare
+patched_op:
+mov edx, 1
+ret
+
+main:
+
+; warm up the cache
+call patched_op
+
+mov byte [rel patched_op + 1], 2
+
+call patched_op
+
+hlt
@@ -0,0 +1,88 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0000000000000000",
+    "RBX": "0xfffffffffffffff7",
+    "RCX": "0xfffffffffffffff7",
+    "RDX": "0xfffffffffffffff7",
+    "RSI": "0x0000000000000001",
+    "RDI": "0x0000000000000000"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; Syscalls with a constant number and a frontend handler become DirectSyscall
+; The handlers turn errno in to a negative return, which has to survive the direct call
+mov r15, 0x100000000
+
+; pipe(r15)
+mov rax, 22
+mov rdi, r15
+syscall
+mov [r15 + 64], rax
+
+; close(-1) = -EBADF
+mov rax, 3
+mov rdi, -1
+syscall
+mov [r15 + 72], rax
+
+; dup(-1) = -EBADF
+mov rax, 32
+mov rdi, -1
+syscall
+mov [r15 + 80], rax
+
+; lseek(-1, 0, SEEK_SET) = -EBADF
+mov rax, 8
+mov rdi, -1
+mov rsi, 0
+mov rdx, 0
+syscall
+mov [r15 + 88], rax
+
+; dup(pipe[0]) returns a new descriptor
+mov rax, 32
+mov edi, [r15]
+syscall
+mov [r15 + 96], rax
+
+; close(dup), close(pipe[0]), close(pipe[1])
+mov rax, 3
+mov rdi, [r15 + 96]
+syscall
+mov [r15 + 104], rax
+mov rax, 3
+mov edi, [r15]
+syscall
+mov rax, 3
+mov edi, [r15 + 4]
+syscall
+
+mov rax, [r15 + 64]
+mov rbx, [r15 + 72]
+mov rcx, [r15 + 80]
+mov rdx, [r15 + 88]
+
+; The duplicated descriptor is valid and differs from both ends of the pipe
+mov rsi, [r15 + 96]
+mov r8d, [r15]
+mov r9d, [r15 + 4]
+cmp rsi, r8
+setne al
+cmp rsi, r9
+setne bl
+and al, bl
+test rsi, rsi
+setns sil
+and sil, al
+movzx esi, sil
+
+mov rax, [r15 + 64]
+mov rbx, [r15 + 72]
+mov rdi, [r15 + 104]
+
+hlt
@@ -0,0 +1,103 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0000000000000008",
+    "RBX": "0x0000000000000008",
+    "RCX": "0x4142434445464748",
+    "RDX": "0xfffffffffffffff7",
+    "RSI": "0xfffffffffffffff5",
+    "RDI": "0x0000000000000000",
+    "R8":  "0xffffffffffffffea",
+    "R9":  "0x0000000000000001"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; read, write and futex become InlineSyscall on x86-64 hosts
+; clock_gettime stays a DirectSyscall so it goes through the host's vDSO, checked here alongside them
+; Both the success and the error paths need to match what the frontend handlers return
+mov r15, 0x100000000
+
+; pipe(r15), so there is something to read and write
+mov rax, 22
+mov rdi, r15
+syscall
+
+mov rax, 0x4142434445464748
+mov [r15 + 16], rax
+
+; write(pipe[1], r15 + 16, 8)
+mov rax, 1
+mov edi, [r15 + 4]
+lea rsi, [r15 + 16]
+mov rdx, 8
+syscall
+mov [r15 + 64], rax
+
+; read(pipe[0], r15 + 24, 8)
+mov rax, 0
+mov edi, [r15]
+lea rsi, [r15 + 24]
+mov rdx, 8
+syscall
+mov [r15 + 72], rax
+
+; write(-1, r15, 0) = -EBADF
+mov rax, 1
+mov rdi, -1
+mov rsi, r15
+mov rdx, 0
+syscall
+mov [r15 + 80], rax
+
+; futex(r15 + 32, FUTEX_WAIT_PRIVATE, 0, NULL) with *uaddr == 1 = -EAGAIN
+mov dword [r15 + 32], 1
+mov rax, 202
+lea rdi, [r15 + 32]
+mov rsi, 128
+mov rdx, 0
+mov r10, 0
+syscall
+mov [r15 + 88], rax
+
+; clock_gettime(CLOCK_MONOTONIC, r15 + 48)
+mov rax, 228
+mov rdi, 1
+lea rsi, [r15 + 48]
+syscall
+mov [r15 + 96], rax
+
+; clock_gettime(100, r15 + 48) = -EINVAL
+mov rax, 228
+mov rdi, 100
+lea rsi, [r15 + 48]
+syscall
+mov [r15 + 104], rax
+
+; close(pipe[0]), close(pipe[1])
+mov rax, 3
+mov edi, [r15]
+syscall
+mov rax, 3
+mov edi, [r15 + 4]
+syscall
+
+mov rax, [r15 + 64]
+mov rbx, [r15 + 72]
+mov rcx, [r15 + 24]
+mov rdx, [r15 + 80]
+mov rsi, [r15 + 88]
+mov rdi, [r15 + 96]
+mov r8,  [r15 + 104]
+
+; The monotonic clock has a time
+mov r9, [r15 + 48]
+or r9, [r15 + 56]
+test r9, r9
+setne r9b
+and r9, 1
+
+hlt
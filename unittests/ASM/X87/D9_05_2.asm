@@ -0,0 +1,55 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x2",
+    "RBX": "0xFFFFFFFFFFFFFFFD",
+    "RCX": "0x3",
+    "RSI": "0xFFFFFFFFFFFFFFFE",
+    "RDI": "0xF7F"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov eax, 0x40200000 ; 2.5
+mov [rdx + 8 * 0], eax
+mov eax, 0xC0200000 ; -2.5
+mov [rdx + 8 * 1], eax
+
+; Round to nearest even
+mov word [rdx + 8 * 2], 0x37F
+fldcw [rdx + 8 * 2]
+fld dword [rdx + 8 * 0]
+fistp qword [rdx + 8 * 3]
+mov rax, [rdx + 8 * 3]
+
+; Round down
+mov word [rdx + 8 * 2], 0x77F
+fldcw [rdx + 8 * 2]
+fld dword [rdx + 8 * 1]
+fistp qword [rdx + 8 * 3]
+mov rbx, [rdx + 8 * 3]
+
+; Round up
+mov word [rdx + 8 * 2], 0xB7F
+fldcw [rdx + 8 * 2]
+fld dword [rdx + 8 * 0]
+fistp qword [rdx + 8 * 3]
+mov rcx, [rdx + 8 * 3]
+
+; Truncate
+mov word [rdx + 8 * 2], 0xF7F
+fldcw [rdx + 8 * 2]
+fld dword [rdx + 8 * 1]
+fistp qword [rdx + 8 * 3]
+mov rsi, [rdx + 8 * 3]
+
+; Control word reads back
+fnstcw [rdx + 8 * 2]
+movzx rdi, word [rdx + 8 * 2]
+
+hlt
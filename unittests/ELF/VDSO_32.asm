@@ -0,0 +1,207 @@
+; Resolves __vdso_clock_gettime through the DT_HASH table of the vDSO that AT_SYSINFO_EHDR points at and calls it
+; Exits with zero if that worked, otherwise with the number of the step that failed
+; Written as a complete ELF so it goes through FEXLoader's auxv setup, assemble with `nasm -f bin`
+BITS 32
+org 0x8048000
+
+ehdr:
+  db 0x7F, "ELF", 1, 1, 1, 0 ; ELFCLASS32, ELFDATA2LSB, EV_CURRENT, ELFOSABI_SYSV
+  times 8 db 0
+  dw 2                       ; e_type: ET_EXEC
+  dw 3                       ; e_machine: EM_386
+  dd 1                       ; e_version
+  dd _start                  ; e_entry
+  dd phdr - $$               ; e_phoff
+  dd 0                       ; e_shoff
+  dd 0                       ; e_flags
+  dw ehdr_size               ; e_ehsize
+  dw phdr_size               ; e_phentsize
+  dw 1                       ; e_phnum
+  dw 40                      ; e_shentsize, checked even without any sections
+  dw 0                       ; e_shnum
+  dw 0                       ; e_shstrndx
+ehdr_size equ $ - ehdr
+
+phdr:
+  dd 1                       ; p_type: PT_LOAD
+  dd 0                       ; p_offset
+  dd $$                      ; p_vaddr
+  dd $$                      ; p_paddr
+  dd file_size               ; p_filesz
+  dd file_size               ; p_memsz
+  dd 7                       ; p_flags: PF_R | PF_W | PF_X
+  dd 0x1000                  ; p_align
+phdr_size equ $ - phdr
+
+_start:
+  ; argc, argv and its null, envp and its null, then the auxv pairs
+  mov eax, [esp]
+  lea esi, [esp + eax * 4 + 8]
+skip_envp:
+  mov eax, [esi]
+  add esi, 4
+  test eax, eax
+  jnz skip_envp
+
+  ; AT_SYSINFO_EHDR
+  mov ebx, 1
+find_auxv:
+  mov eax, [esi]
+  test eax, eax
+  jz exit
+  cmp eax, 33
+  je found_auxv
+  add esi, 8
+  jmp find_auxv
+found_auxv:
+  mov eax, [esi + 4]
+  mov [bias], eax
+  mov ebx, 2
+  test eax, eax
+  jz exit
+
+  ; The load bias is the base minus the first PT_LOAD's address, PT_DYNAMIC is the dynamic section
+  mov esi, [eax + 28]        ; e_phoff
+  add esi, eax
+  movzx ecx, word [eax + 44] ; e_phnum
+  movzx edx, word [eax + 42] ; e_phentsize
+  mov edi, -1
+  xor ebp, ebp
+find_phdrs:
+  test ecx, ecx
+  jz found_phdrs
+  cmp dword [esi], 1         ; PT_LOAD
+  jne not_load
+  cmp edi, -1
+  jne next_phdr
+  mov edi, [esi + 8]         ; p_vaddr
+  jmp next_phdr
+not_load:
+  cmp dword [esi], 2         ; PT_DYNAMIC
+  jne next_phdr
+  mov ebp, [esi + 8]         ; p_vaddr
+next_phdr:
+  add esi, edx
+  dec ecx
+  jmp find_phdrs
+found_phdrs:
+  mov ebx, 3
+  cmp edi, -1
+  je exit
+  test ebp, ebp
+  jz exit
+  sub [bias], edi
+
+  mov esi, ebp
+  add esi, [bias]
+walk_dynamic:
+  mov eax, [esi]
+  test eax, eax
+  jz walked_dynamic
+  mov edx, [esi + 4]
+  add edx, [bias]
+  cmp eax, 4
+  jne not_hash
+  mov [hash], edx
+not_hash:
+  cmp eax, 5
+  jne not_strtab
+  mov [strtab], edx
+not_strtab:
+  cmp eax, 6
+  jne not_symtab
+  mov [symtab], edx
+not_symtab:
+  add esi, 8
+  jmp walk_dynamic
+walked_dynamic:
+  mov ebx, 4
+  cmp dword [hash], 0
+  je exit
+  cmp dword [symtab], 0
+  je exit
+  cmp dword [strtab], 0
+  je exit
+
+  ; SysV ELF hash of the name
+  mov esi, name
+  xor eax, eax
+hash_name:
+  movzx edx, byte [esi]
+  test edx, edx
+  jz hashed_name
+  shl eax, 4
+  add eax, edx
+  mov edx, eax
+  and edx, 0xF0000000
+  mov ecx, edx
+  shr ecx, 24
+  xor eax, ecx
+  not edx
+  and eax, edx
+  inc esi
+  jmp hash_name
+hashed_name:
+
+  ; nbucket, nchain, buckets, chains
+  mov ebp, [hash]
+  xor edx, edx
+  div dword [ebp]
+  mov ecx, [ebp + 8 + edx * 4]
+  mov eax, [ebp]
+  lea ebp, [ebp + 8 + eax * 4]
+  mov ebx, 5
+walk_chain:
+  test ecx, ecx
+  jz exit
+  mov edx, ecx
+  shl edx, 4                 ; sizeof(Elf32_Sym)
+  add edx, [symtab]
+  mov edi, [edx]             ; st_name
+  add edi, [strtab]
+  mov esi, name
+compare_name:
+  mov al, [edi]
+  cmp al, [esi]
+  jne next_symbol
+  test al, al
+  jz found_symbol
+  inc edi
+  inc esi
+  jmp compare_name
+next_symbol:
+  mov ecx, [ebp + ecx * 4]
+  jmp walk_chain
+
+found_symbol:
+  mov eax, [edx + 4]         ; st_value
+  add eax, [bias]
+  push ts
+  push 1                     ; CLOCK_MONOTONIC
+  call eax
+  add esp, 8
+
+  mov ebx, 6
+  test eax, eax
+  jnz exit
+
+  ; The monotonic clock has been running since boot
+  mov ebx, 7
+  mov eax, [ts]
+  or eax, [ts + 4]
+  jz exit
+
+  xor ebx, ebx
+exit:
+  mov eax, 252               ; exit_group
+  int 0x80
+
+name: db "__vdso_clock_gettime", 0
+align 4
+bias: dd 0
+hash: dd 0
+symtab: dd 0
+strtab: dd 0
+ts: dd 0, 0
+
+file_size equ $ - $$
@@ -0,0 +1,197 @@
+; Resolves __vdso_clock_gettime through the DT_HASH table of the vDSO that AT_SYSINFO_EHDR points at and calls it
+; Exits with zero if that worked, otherwise with the number of the step that failed
+; Written as a complete ELF so it goes through FEXLoader's auxv setup, assemble with `nasm -f bin`
+BITS 64
+org 0x400000
+
+ehdr:
+  db 0x7F, "ELF", 2, 1, 1, 0 ; ELFCLASS64, ELFDATA2LSB, EV_CURRENT, ELFOSABI_SYSV
+  times 8 db 0
+  dw 2                       ; e_type: ET_EXEC
+  dw 0x3E                    ; e_machine: EM_X86_64
+  dd 1                       ; e_version
+  dq _start                  ; e_entry
+  dq phdr - $$               ; e_phoff
+  dq 0                       ; e_shoff
+  dd 0                       ; e_flags
+  dw ehdr_size               ; e_ehsize
+  dw phdr_size               ; e_phentsize
+  dw 1                       ; e_phnum
+  dw 64                      ; e_shentsize, checked even without any sections
+  dw 0                       ; e_shnum
+  dw 0                       ; e_shstrndx
+ehdr_size equ $ - ehdr
+
+phdr:
+  dd 1                       ; p_type: PT_LOAD
+  dd 7                       ; p_flags: PF_R | PF_W | PF_X
+  dq 0                       ; p_offset
+  dq $$                      ; p_vaddr
+  dq $$                      ; p_paddr
+  dq file_size               ; p_filesz
+  dq file_size               ; p_memsz
+  dq 0x1000                  ; p_align
+phdr_size equ $ - phdr
+
+_start:
+  ; argc, argv and its null, envp and its null, then the auxv pairs
+  mov rax, [rsp]
+  lea rsi, [rsp + rax * 8 + 16]
+skip_envp:
+  mov rax, [rsi]
+  add rsi, 8
+  test rax, rax
+  jnz skip_envp
+
+  ; AT_SYSINFO_EHDR
+  mov ebx, 1
+find_auxv:
+  mov rax, [rsi]
+  test rax, rax
+  jz exit
+  cmp rax, 33
+  je found_auxv
+  add rsi, 16
+  jmp find_auxv
+found_auxv:
+  mov r12, [rsi + 8]
+  mov ebx, 2
+  test r12, r12
+  jz exit
+
+  ; The load bias is the base minus the first PT_LOAD's address, PT_DYNAMIC is the dynamic section
+  mov rsi, [r12 + 32]        ; e_phoff
+  add rsi, r12
+  movzx ecx, word [r12 + 56] ; e_phnum
+  movzx edx, word [r12 + 54] ; e_phentsize
+  mov r13, -1
+  xor r8d, r8d
+find_phdrs:
+  test ecx, ecx
+  jz found_phdrs
+  cmp dword [rsi], 1         ; PT_LOAD
+  jne not_load
+  cmp r13, -1
+  jne next_phdr
+  mov r13, [rsi + 16]        ; p_vaddr
+  jmp next_phdr
+not_load:
+  cmp dword [rsi], 2         ; PT_DYNAMIC
+  jne next_phdr
+  mov r8, [rsi + 16]         ; p_vaddr
+next_phdr:
+  add rsi, rdx
+  dec ecx
+  jmp find_phdrs
+found_phdrs:
+  mov ebx, 3
+  cmp r13, -1
+  je exit
+  test r8, r8
+  jz exit
+  sub r12, r13
+
+  ; r13 = DT_HASH, r14 = DT_SYMTAB, r15 = DT_STRTAB
+  lea rsi, [r8 + r12]
+  xor r13d, r13d
+  xor r14d, r14d
+  xor r15d, r15d
+walk_dynamic:
+  mov rax, [rsi]
+  test rax, rax
+  jz walked_dynamic
+  mov rdx, [rsi + 8]
+  add rdx, r12
+  cmp rax, 4
+  cmove r13, rdx
+  cmp rax, 5
+  cmove r15, rdx
+  cmp rax, 6
+  cmove r14, rdx
+  add rsi, 16
+  jmp walk_dynamic
+walked_dynamic:
+  mov ebx, 4
+  test r13, r13
+  jz exit
+  test r14, r14
+  jz exit
+  test r15, r15
+  jz exit
+
+  ; SysV ELF hash of the name
+  lea rsi, [rel name]
+  xor eax, eax
+hash_name:
+  movzx edx, byte [rsi]
+  test edx, edx
+  jz hashed_name
+  shl eax, 4
+  add eax, edx
+  mov edx, eax
+  and edx, 0xF0000000
+  mov ecx, edx
+  shr ecx, 24
+  xor eax, ecx
+  not edx
+  and eax, edx
+  inc rsi
+  jmp hash_name
+hashed_name:
+
+  ; nbucket, nchain, buckets, chains
+  xor edx, edx
+  div dword [r13]
+  mov ecx, [r13 + 8 + rdx * 4]
+  mov r8d, [r13]
+  lea r8, [r13 + 8 + r8 * 4]
+  mov ebx, 5
+walk_chain:
+  test ecx, ecx
+  jz exit
+  imul rax, rcx, 24          ; sizeof(Elf64_Sym)
+  lea r9, [r14 + rax]
+  mov eax, [r9]              ; st_name
+  lea rdi, [r15 + rax]
+  lea rsi, [rel name]
+compare_name:
+  mov al, [rdi]
+  cmp al, [rsi]
+  jne next_symbol
+  test al, al
+  jz found_symbol
+  inc rdi
+  inc rsi
+  jmp compare_name
+next_symbol:
+  mov ecx, [r8 + rcx * 4]
+  jmp walk_chain
+
+found_symbol:
+  mov rax, [r9 + 8]          ; st_value
+  add rax, r12
+  mov edi, 1                 ; CLOCK_MONOTONIC
+  lea rsi, [rel ts]
+  call rax
+
+  mov ebx, 6
+  test rax, rax
+  jnz exit
+
+  ; The monotonic clock has been running since boot
+  mov ebx, 7
+  mov rax, [rel ts]
+  or rax, [rel ts + 8]
+  jz exit
+
+  xor ebx, ebx
+exit:
+  mov edi, ebx
+  mov eax, 231               ; exit_group
+  syscall
+
+name: db "__vdso_clock_gettime", 0
+align 8
+ts: dq 0, 0
+
+file_size equ $ - $$